@@ -67,7 +67,8 @@ typedef enum gr_error {
     GR_ERROR_NUMERICAL_INSTABILITY,
     GR_ERROR_PRICING_ENGINE_FAILED,
     GR_ERROR_CONSTRAINT_VIOLATION,
-    GR_ERROR_NOT_INITIALIZED
+    GR_ERROR_NOT_INITIALIZED,
+    GR_ERROR_IO
 } gr_error_t;
 
 GR_API const char* gr_error_string(gr_error_t err);
@@ -128,6 +129,13 @@ GR_API gr_error_t gr_context_set_fdp_library(gr_context_t* ctx, const char* path
 GR_API void gr_context_set_bump_size(gr_context_t* ctx, double bump);
 GR_API void gr_context_set_num_threads(gr_context_t* ctx, int threads);
 
+/*
+ * Declare that pricing callbacks passed to direct-pricer routines may be
+ * called concurrently from several threads. Off by default; when on and
+ * num_threads > 1, bumped evaluations run in parallel.
+ */
+GR_API void gr_context_set_pricer_reentrant(gr_context_t* ctx, int reentrant);
+
 /* Error handling */
 GR_API gr_error_t gr_context_get_last_error(const gr_context_t* ctx);
 GR_API const char* gr_context_get_error_message(const gr_context_t* ctx);
@@ -184,6 +192,57 @@ GR_API gr_error_t gr_state_space_map_prices(
     void*             user_data
 );
 
+/* Re-price only grid nodes with lo[d] <= index[d] <= hi[d] (after a full map) */
+GR_API gr_error_t gr_state_space_map_prices_box(
+    gr_state_space_t* space,
+    gr_pricing_fn     fn,
+    void*             user_data,
+    const int*        lo,
+    const int*        hi
+);
+
+/*
+ * Adjoint (AAD) pricing callback: returns the price and writes the full
+ * gradient into out_gradient[num_dims] in a single call.
+ *
+ * Register one against a plain pricer with gr_context_register_adjoint.
+ * gr_state_space_map_prices and gr_jacobian_compute_direct then call the
+ * adjoint instead, so gradient cost no longer scales with dimension.
+ */
+typedef double (*gr_adjoint_pricing_fn)(
+    const double* coordinates,
+    int           num_dims,
+    void*         user_data,
+    double*       out_gradient
+);
+
+/* Pass adjoint = NULL to unregister */
+GR_API gr_error_t gr_context_register_adjoint(
+    gr_context_t*         ctx,
+    gr_pricing_fn         fn,
+    gr_adjoint_pricing_fn adjoint
+);
+
+/*
+ * Hyper-dual pricing callback for exact derivatives.
+ *
+ * A hyper-dual number x = re + e1·ε1 + e2·ε2 + e12·ε1ε2 (ε1² = ε2² = 0)
+ * propagates first and mixed second derivatives through the pricer with
+ * no bump. Arithmetic helpers live in georisk_dual.h.
+ */
+typedef struct gr_hyperdual {
+    double re;
+    double e1;
+    double e2;
+    double e12;
+} gr_hyperdual_t;
+
+typedef gr_hyperdual_t (*gr_hyperdual_pricing_fn)(
+    const gr_hyperdual_t* coordinates,
+    int                   num_dims,
+    void*                 user_data
+);
+
 /* ============================================================================
  * Jacobian - First-Order Sensitivity Structure
  * 
@@ -201,6 +260,68 @@ GR_API gr_error_t gr_jacobian_compute(
     const double*           point   /* Where in state space */
 );
 
+/* Central differences straight on a pricer (no grid); bump_size <= 0 uses ctx */
+GR_API gr_error_t gr_jacobian_compute_direct(
+    gr_jacobian_t* jac,
+    gr_pricing_fn  fn,
+    void*          user_data,
+    const double*  point,
+    double         bump_size
+);
+
+/*
+ * Adaptive-step differentiation (Ridders' Richardson extrapolation).
+ * Each partial is refined over a shrinking step sequence until its error
+ * estimate drops below tolerance, the tableau is exhausted, or the
+ * shared pricer-call budget runs out.
+ */
+typedef struct gr_adaptive_diff_config {
+    double initial_step;     /* Relative to max(|x_i|, 1) */
+    double step_ratio;       /* Step shrink factor per level (> 1) */
+    double tolerance;        /* Target absolute error per partial */
+    int    max_levels;       /* Tableau depth (<= 16) */
+    int    max_evaluations;  /* Pricer call budget, 0 = unlimited */
+} gr_adaptive_diff_config_t;
+
+#define GR_ADAPTIVE_DIFF_CONFIG_DEFAULT { 0.1, 1.4, 1e-8, 10, 0 }
+
+GR_API gr_error_t gr_jacobian_compute_adaptive(
+    gr_jacobian_t*                   jac,
+    gr_pricing_fn                    fn,
+    void*                            user_data,
+    const double*                    point,
+    const gr_adaptive_diff_config_t* config,      /* NULL = defaults */
+    double*                          out_errors,  /* Optional, num_dims */
+    int*                             out_evaluations  /* Optional */
+);
+
+/* Exact gradient from a hyper-dual pricer: one pricer call per dimension */
+GR_API gr_error_t gr_jacobian_compute_hyperdual(
+    gr_jacobian_t*          jac,
+    gr_hyperdual_pricing_fn fn,
+    void*                   user_data,
+    const double*           point
+);
+
+/*
+ * Directional derivative ∇f · v on the mapped grid (v not normalised).
+ * Two evaluations per direction instead of 2n for the full gradient.
+ * The batched form takes row-major directions [num_directions x num_dims].
+ */
+GR_API double gr_directional_derivative(
+    const gr_state_space_t* space,
+    const double*           point,
+    const double*           direction
+);
+
+GR_API gr_error_t gr_directional_derivatives(
+    const gr_state_space_t* space,
+    const double*           point,
+    const double*           directions,
+    int                     num_directions,
+    double*                 out
+);
+
 GR_API double gr_jacobian_get(const gr_jacobian_t* jac, int dim);
 GR_API double gr_jacobian_norm(const gr_jacobian_t* jac);  /* Gradient magnitude */
 
@@ -221,6 +342,30 @@ GR_API gr_error_t gr_hessian_compute(
     const double*           point
 );
 
+/* Exact Hessian from a hyper-dual pricer: n(n+1)/2 pricer calls */
+GR_API gr_error_t gr_hessian_compute_hyperdual(
+    gr_hessian_t*           hess,
+    gr_hyperdual_pricing_fn fn,
+    void*                   user_data,
+    const double*           point
+);
+
+/*
+ * H·v on a direct pricer without forming the Hessian: the gradient
+ * difference along v, 4n pricer calls (two adjoint calls if one is
+ * registered) against 2n² + 1 for the full stencil. v need not be unit;
+ * the bump is ctx's bump size. Runs in parallel for reentrant pricers.
+ */
+GR_API gr_error_t gr_hessian_vector_product_direct(
+    gr_context_t* ctx,
+    gr_pricing_fn fn,
+    void*         user_data,
+    const double* point,
+    const double* v,
+    int           num_dims,
+    double*       out       /* Output: num_dims */
+);
+
 GR_API double gr_hessian_get(const gr_hessian_t* hess, int row, int col);
 
 /* Curvature analysis */
@@ -230,10 +375,91 @@ GR_API gr_error_t gr_hessian_eigenvalues(
     int                 num_eigenvalues
 );
 
+/*
+ * Principal curvature directions: row j of eigenvectors [num_vectors x n]
+ * is the unit eigenvector for eigenvalue j (same order as above, sign
+ * fixed so the largest component is positive). eigenvalues may be NULL.
+ */
+GR_API gr_error_t gr_hessian_eigenvectors(
+    const gr_hessian_t* hess,
+    double*             eigenvalues,    /* Optional output, num_vectors */
+    double*             eigenvectors,   /* Output: row-major, num_vectors x n */
+    int                 num_vectors
+);
+
+/*
+ * Matrix-free extreme curvature: Lanczos on Hessian-vector products
+ * (two grid gradients each), never forming the Hessian. Returns the k
+ * algebraically largest (descending) and smallest (ascending) eigenpairs
+ * and a condition estimate from the Ritz values. Vectors are row-major
+ * [k x n] and optional, as are the condition and product count.
+ */
+GR_API gr_error_t gr_hessian_lanczos(
+    const gr_state_space_t* space,
+    const double*           point,
+    int                     k,
+    double*                 top_values,
+    double*                 top_vectors,
+    double*                 bottom_values,
+    double*                 bottom_vectors,
+    double*                 out_condition,
+    int*                    out_products
+);
+
+/*
+ * Scan mode: seed each eigen-solve with the eigenvectors of the previous
+ * one. When consecutive computes are at neighbouring points the matrix
+ * starts nearly diagonal and converges in a sweep or two.
+ */
+GR_API void gr_hessian_set_warm_start(gr_hessian_t* hess, int enable);
+
 GR_API double gr_hessian_trace(const gr_hessian_t* hess);       /* Sum of eigenvalues */
 GR_API double gr_hessian_frobenius_norm(const gr_hessian_t* hess);
 GR_API double gr_hessian_condition_number(const gr_hessian_t* hess);
 
+/*
+ * Hessian at every grid node in one sweep over the price grid (no
+ * interpolation). out_packed holds, per node in flat-index order, the
+ * n(n+1)/2 upper-triangular entries row by row: H00, H01 .. H0n-1, H11 ..
+ * Frobenius and trace grids (total_points each) are optional; at least
+ * one output must be given.
+ */
+GR_API gr_error_t gr_state_space_hessian_field(
+    const gr_state_space_t* space,
+    double*                 out_packed,
+    double*                 out_frobenius,
+    double*                 out_trace
+);
+
+/* ============================================================================
+ * Local Geometry - Value, Gradient and Curvature in One Pass
+ *
+ * Evaluates a single finite-difference stencil (grid-spacing steps) and
+ * fills both the Jacobian and the Hessian from it. Cheaper than calling
+ * gr_jacobian_compute and gr_hessian_compute back to back, which would
+ * interpolate the centre and axial points twice.
+ * ============================================================================ */
+
+GR_API gr_error_t gr_local_geometry_compute(
+    gr_jacobian_t*          jac,
+    gr_hessian_t*           hess,
+    const gr_state_space_t* space,
+    const double*           point
+);
+
+/*
+ * Closed-form derivatives of the grid interpolant, no stencil. Gradient
+ * and cross partials are exact within the containing cell; the diagonal
+ * is interpolated from node second differences of neighbouring cells.
+ * Either jac or hess may be NULL.
+ */
+GR_API gr_error_t gr_local_geometry_compute_analytic(
+    gr_jacobian_t*          jac,
+    gr_hessian_t*           hess,
+    const gr_state_space_t* space,
+    const double*           point
+);
+
 /* ============================================================================
  * Fragility Map - Where Small Perturbations Generate Large Effects
  * 
@@ -248,6 +474,24 @@ typedef struct gr_fragility_point {
     int     near_constraint;    /* Boolean: close to constraint surface */
 } gr_fragility_point_t;
 
+/*
+ * Score weights and scales. Each component is mapped into [0, 1]
+ * (gradient and curvature as x/(1+x) of norm/scale, conditioning as
+ * log(cond)/log(condition_threshold), constraints linearly inside
+ * constraint_threshold) and the weighted sum is clamped to [0, 1].
+ */
+typedef struct gr_fragility_config {
+    double gradient_weight;
+    double curvature_weight;
+    double condition_weight;
+    double constraint_weight;
+    double gradient_scale;
+    double curvature_scale;
+    double condition_threshold;
+    double constraint_threshold;
+    double fragility_threshold;     /* Score at which a node is fragile */
+} gr_fragility_config_t;
+
 GR_API gr_fragility_map_t* gr_fragility_map_new(
     gr_context_t*     ctx,
     gr_state_space_t* space
@@ -256,6 +500,103 @@ GR_API void gr_fragility_map_free(gr_fragility_map_t* map);
 
 GR_API gr_error_t gr_fragility_map_compute(gr_fragility_map_t* map);
 
+/*
+ * Coarse-to-fine search: score the corners of stride-sized boxes, then
+ * refine by halving only boxes with a corner at or above
+ * fragility_threshold - margin. Other boxes are filled by interpolating
+ * corner scores and contribute to the grid and statistics as estimates;
+ * only scored nodes are listed as fragile. Features narrower than a
+ * stride box can slip between its corners, so choose stride below the
+ * scale of the structures of interest. out_evaluated (optional)
+ * receives the number of nodes actually scored, against
+ * gr_state_space_get_total_points.
+ */
+GR_API gr_error_t gr_fragility_map_compute_multires(
+    gr_fragility_map_t* map,
+    int                 stride,
+    double              margin,
+    size_t*             out_evaluated
+);
+
+/*
+ * Incremental update after gr_state_space_map_prices_box(lo, hi): rescores
+ * only nodes whose stencil reaches into the box and patches the grid,
+ * summary statistics and fragile list. Computes in full if the map has
+ * not been computed yet.
+ */
+GR_API gr_error_t gr_fragility_map_update(
+    gr_fragility_map_t* map,
+    const int*          lo,
+    const int*          hi
+);
+
+/*
+ * Bind a constraint surface (NULL unbinds); the surface is borrowed and
+ * must outlive the map. Each compute evaluates the signed distance to the
+ * nearest active constraint over the whole grid, feeds it into the score
+ * through constraint_weight and flags nodes within constraint_threshold
+ * as near_constraint. gr_fragility_map_update reuses the distances from
+ * the last compute.
+ */
+GR_API void gr_fragility_map_set_constraints(
+    gr_fragility_map_t*            map,
+    const gr_constraint_surface_t* constraints
+);
+
+/* Configuration used by the next compute (defaults on creation) */
+GR_API gr_error_t gr_fragility_map_set_config(
+    gr_fragility_map_t*          map,
+    const gr_fragility_config_t* config
+);
+GR_API gr_error_t gr_fragility_map_get_config(
+    const gr_fragility_map_t* map,
+    gr_fragility_config_t*    out
+);
+
+/*
+ * Component cache: keep each node's gradient norm, Frobenius norm and
+ * condition number (plus the constraint distance field) from the next
+ * gr_fragility_map_compute, at three doubles per node. While enabled the
+ * screening shortcut is skipped so every condition number is exact.
+ * gr_fragility_map_rescore then applies a new configuration by
+ * recombining the cached components, rebuilding the scores, statistics
+ * and fragile list without touching derivatives. The multiresolution
+ * search leaves the cache invalid.
+ */
+GR_API void gr_fragility_map_set_component_cache(gr_fragility_map_t* map, int enable);
+GR_API gr_error_t gr_fragility_map_rescore(
+    gr_fragility_map_t*          map,
+    const gr_fragility_config_t* config
+);
+
+/*
+ * Screening: bound each node's score from the gradient norm, Frobenius
+ * norm and a Gershgorin condition bound, and skip the eigen-solve where
+ * the bound is already below fragility_threshold; such nodes store the
+ * bound (clamped to [0, 1]) as their grid score. The fragile set, the
+ * fragile scores and max_fragility are identical to an unscreened
+ * compute. Everything read from the grid outside the fragile set (point
+ * and interpolated queries, level sets, export, and so mean_fragility)
+ * is an upper estimate at screened nodes. Ignored while the component
+ * cache is on, which needs every condition number.
+ *
+ * gr_fragility_map_get_num_eigen_solves reports the solves run by the
+ * last compute, update or multiresolution search.
+ */
+GR_API void gr_fragility_map_set_screening(gr_fragility_map_t* map, int enable);
+GR_API size_t gr_fragility_map_get_num_screened(const gr_fragility_map_t* map);
+GR_API size_t gr_fragility_map_get_num_eigen_solves(const gr_fragility_map_t* map);
+
+/*
+ * Keep only the k highest-scoring fragile nodes (0, the default, keeps
+ * all of them), so the fragile list stays bounded however many nodes
+ * cross the threshold. The kept nodes are still listed in flat order and
+ * fragile_fraction still counts every fragile node. Takes effect on the
+ * next compute; gr_fragility_map_update recomputes in full while set.
+ */
+GR_API void gr_fragility_map_set_top_k(gr_fragility_map_t* map, size_t k);
+
+/* Fragile nodes in flat order; coordinates stay valid until the next compute */
 GR_API size_t gr_fragility_map_get_num_fragile_regions(const gr_fragility_map_t* map);
 GR_API gr_error_t gr_fragility_map_get_region(
     const gr_fragility_map_t* map,
@@ -263,12 +604,130 @@ GR_API gr_error_t gr_fragility_map_get_region(
     gr_fragility_point_t*     out
 );
 
+/*
+ * Fragile clusters: connected components of nodes at or above
+ * fragility_threshold, joined across grid faces (one step along one
+ * axis). gr_fragility_map_cluster labels the current grid scores and
+ * keeps one summary per component, ordered by lowest flat index. Any
+ * compute, update, multiresolution search or rescore drops the
+ * summaries; call it again afterwards. Coordinate arrays hold num_dims
+ * values and are owned by the map.
+ */
+typedef struct gr_fragility_cluster {
+    const double* lower;        /* Bounding box of member nodes */
+    const double* upper;
+    const double* peak;         /* Node with the highest score */
+    double        peak_score;
+    double        mean_score;
+    size_t        volume;       /* Number of member nodes */
+} gr_fragility_cluster_t;
+
+GR_API gr_error_t gr_fragility_map_cluster(gr_fragility_map_t* map);
+GR_API size_t gr_fragility_map_get_num_clusters(const gr_fragility_map_t* map);
+GR_API gr_error_t gr_fragility_map_get_cluster(
+    const gr_fragility_map_t* map,
+    size_t                    index,
+    gr_fragility_cluster_t*   out
+);
+
+/*
+ * Write the map to a versioned binary columnar file for memory-mapping
+ * (layout in georisk_columnar.h): the dimension table, summary
+ * statistics, grid scores, cached component grids and constraint
+ * distances when present, the fragile node list and the cluster table
+ * if gr_fragility_map_cluster has run on the current scores. Grid
+ * columns are streamed straight from the map's arrays.
+ */
+GR_API gr_error_t gr_fragility_map_export(
+    const gr_fragility_map_t* map,
+    const char*               path
+);
+
+/*
+ * Level sets of the grid scores, with score >= level counted as inside;
+ * pass the config's fragility_threshold for the fragile boundary.
+ *
+ * The slice extractors take 2 or 3 distinct axes and hold every other
+ * axis at fixed[d] (num_dims entries, slice axes ignored; NULL means
+ * index 0). Contours come back as line segments, surfaces as triangles,
+ * both indexed: vertices holds one point per crossed grid edge (dims
+ * coords each, slice-axis order, grid coordinates, sorted by edge), and
+ * indices holds dims vertex indices per element, so neighbouring
+ * elements share their common vertex. Elements are unoriented and ordered by cell. Buffers are allocated
+ * from the map's context and released with gr_level_set_free.
+ *
+ * gr_fragility_boundary_cells lists, in flat order, the lower-corner flat
+ * index of every n-D cell whose 2^num_dims corners straddle the level.
+ */
+typedef struct gr_level_set {
+    double* vertices;           /* num_vertices x dims coordinates */
+    size_t  num_vertices;
+    size_t* indices;            /* num_elements x dims vertex indices */
+    size_t  num_elements;       /* Segments (dims 2) or triangles (dims 3) */
+    int     dims;
+} gr_level_set_t;
+
+typedef struct gr_boundary_cells {
+    size_t* cells;
+    size_t  num_cells;
+} gr_boundary_cells_t;
+
+GR_API gr_error_t gr_fragility_contour_2d(
+    const gr_fragility_map_t* map,
+    int                       axis_x,
+    int                       axis_y,
+    const int*                fixed,
+    double                    level,
+    gr_level_set_t*           out
+);
+GR_API gr_error_t gr_fragility_isosurface_3d(
+    const gr_fragility_map_t* map,
+    int                       axis_x,
+    int                       axis_y,
+    int                       axis_z,
+    const int*                fixed,
+    double                    level,
+    gr_level_set_t*           out
+);
+GR_API void gr_level_set_free(const gr_fragility_map_t* map, gr_level_set_t* set);
+
+GR_API gr_error_t gr_fragility_boundary_cells(
+    const gr_fragility_map_t* map,
+    double                    level,
+    gr_boundary_cells_t*      out
+);
+GR_API void gr_boundary_cells_free(const gr_fragility_map_t* map, gr_boundary_cells_t* cells);
+
+/* Summary statistics from the last compute */
+GR_API double gr_fragility_map_get_max(const gr_fragility_map_t* map);
+GR_API double gr_fragility_map_get_mean(const gr_fragility_map_t* map);
+GR_API double gr_fragility_map_get_fragile_fraction(const gr_fragility_map_t* map);
+
 /* Get fragility at a specific point */
 GR_API double gr_fragility_at_point(
     const gr_fragility_map_t* map,
     const double*             coordinates
 );
 
+/*
+ * Multilinear interpolation of the grid scores instead of the nearest
+ * node, located by uniform-grid arithmetic so each query is independent
+ * of the grid size. Coordinates outside the grid, however far, clamp to
+ * the edge; a NaN coordinate gives NaN. The batch form reads count
+ * points stored row-major (count x num_dims) and splits them over
+ * ctx->num_threads.
+ */
+GR_API double gr_fragility_at_point_interpolated(
+    const gr_fragility_map_t* map,
+    const double*             coordinates
+);
+GR_API gr_error_t gr_fragility_at_points_interpolated(
+    const gr_fragility_map_t* map,
+    const double*             coordinates,
+    size_t                    count,
+    double*                   out
+);
+
 /* ============================================================================
  * Constraint Surfaces - The Boundaries of Admissible States
  * 
@@ -297,6 +756,24 @@ GR_API gr_error_t gr_constraint_add(
     double                   threshold
 );
 
+/*
+ * Bind constraint `index` (in order of addition) to what it measures:
+ * one coordinate, or a function of all coordinates. Binding one replaces
+ * the other; an unbound constraint measures 0 everywhere.
+ */
+GR_API gr_error_t gr_constraint_bind_dimension(
+    gr_constraint_surface_t* surface,
+    int                      index,
+    int                      dimension
+);
+
+GR_API gr_error_t gr_constraint_bind_function(
+    gr_constraint_surface_t* surface,
+    int                      index,
+    gr_pricing_fn            fn,
+    void*                    user_data
+);
+
 /* Check if a point violates any constraint */
 GR_API int gr_constraint_check(
     const gr_constraint_surface_t* surface,
@@ -0,0 +1,166 @@
+/**
+ * georisk_columnar.h - On-disk layout of exported fragility maps
+ *
+ * gr_fragility_map_export writes one file laid out for memory-mapping:
+ *
+ *   header      gr_columnar_header_t
+ *   dimensions  num_dims x gr_columnar_dimension_t    at dims_offset
+ *   directory   num_columns x gr_columnar_column_t    at columns_offset
+ *   columns     raw arrays, each starting on a GR_COLUMNAR_ALIGN boundary
+ *
+ * Grid columns hold total_points values in the state space's flat order
+ * (row-major, last dimension fastest; see the strides in the dimension
+ * table). Cluster columns hold one row per cluster, with coordinate
+ * columns num_dims values wide. Columns the map had no data for (no
+ * component cache, no constraint surface, no clusters) are left out of
+ * the directory. Values are in the writer's byte order; the endian field
+ * lets a reader detect a mismatch.
+ *
+ * A reader maps the file and uses gr_columnar_column_data to get typed
+ * pointers straight into it, with no parsing or copying.
+ */
+
+#ifndef GEORISK_COLUMNAR_H_INCLUDED
+#define GEORISK_COLUMNAR_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GR_COLUMNAR_MAGIC    "GRFRAGMP"
+#define GR_COLUMNAR_VERSION  1u
+#define GR_COLUMNAR_ENDIAN   0x01020304u
+#define GR_COLUMNAR_ALIGN    64u
+
+/* ============================================================================
+ * Layout
+ * ============================================================================ */
+
+typedef struct gr_columnar_header {
+    char     magic[8];              /* GR_COLUMNAR_MAGIC, not terminated */
+    uint32_t version;               /* GR_COLUMNAR_VERSION */
+    uint32_t endian;                /* GR_COLUMNAR_ENDIAN as written */
+    uint32_t num_dims;
+    uint32_t num_columns;
+    uint64_t total_points;
+    uint64_t num_clusters;
+    uint64_t num_fragile;           /* Rows in GR_COLUMN_FRAGILE_NODES */
+    uint64_t dims_offset;
+    uint64_t columns_offset;
+    double   fragility_threshold;
+    double   max_fragility;
+    double   mean_fragility;
+    double   fragile_fraction;
+} gr_columnar_header_t;
+
+typedef struct gr_columnar_dimension {
+    double   min_value;
+    double   max_value;
+    uint64_t num_points;
+    uint64_t stride;                /* Flat-index step along this axis */
+} gr_columnar_dimension_t;
+
+typedef struct gr_columnar_column {
+    uint32_t id;                    /* gr_columnar_column_id_t */
+    uint32_t type;                  /* gr_columnar_type_t */
+    uint64_t offset;                /* From the start of the file */
+    uint64_t count;                 /* Number of elements */
+} gr_columnar_column_t;
+
+typedef enum gr_columnar_type {
+    GR_COLUMNAR_F64 = 1,
+    GR_COLUMNAR_U64 = 2
+} gr_columnar_type_t;
+
+typedef enum gr_columnar_column_id {
+    /* Per node, total_points values */
+    GR_COLUMN_SCORES = 1,
+    GR_COLUMN_GRADIENT_NORM,
+    GR_COLUMN_FROBENIUS,
+    GR_COLUMN_CONDITION,
+    GR_COLUMN_CONSTRAINT_DISTANCE,
+
+    /* Flat indices of listed fragile nodes (u64) */
+    GR_COLUMN_FRAGILE_NODES,
+
+    /* Per cluster; coordinate columns are num_dims wide */
+    GR_COLUMN_CLUSTER_LOWER,
+    GR_COLUMN_CLUSTER_UPPER,
+    GR_COLUMN_CLUSTER_PEAK,
+    GR_COLUMN_CLUSTER_PEAK_SCORE,
+    GR_COLUMN_CLUSTER_MEAN_SCORE,
+    GR_COLUMN_CLUSTER_VOLUME        /* u64 */
+} gr_columnar_column_id_t;
+
+/* ============================================================================
+ * Reader
+ * ============================================================================ */
+
+/* count elements of elem_size bytes at offset fit in size, without overflow */
+static inline int gr_columnar_fits(uint64_t offset, uint64_t count, uint64_t elem_size, size_t size)
+{
+    if (offset > size) return 0;
+    return count <= ((uint64_t)size - offset) / elem_size;
+}
+
+/*
+ * Validate the header of a mapped file of the given size; NULL if the
+ * magic, version or byte order does not match or the tables are
+ * misaligned or run past the end.
+ */
+static inline const gr_columnar_header_t* gr_columnar_header(const void* base, size_t size)
+{
+    if (!base || size < sizeof(gr_columnar_header_t)) return NULL;
+
+    const gr_columnar_header_t* h = (const gr_columnar_header_t*)base;
+    if (memcmp(h->magic, GR_COLUMNAR_MAGIC, sizeof(h->magic)) != 0) return NULL;
+    if (h->version != GR_COLUMNAR_VERSION || h->endian != GR_COLUMNAR_ENDIAN) return NULL;
+
+    if (h->dims_offset % 8u != 0 || h->columns_offset % 8u != 0) return NULL;
+    if (!gr_columnar_fits(h->dims_offset, h->num_dims,
+                          sizeof(gr_columnar_dimension_t), size)) return NULL;
+    if (!gr_columnar_fits(h->columns_offset, h->num_columns,
+                          sizeof(gr_columnar_column_t), size)) return NULL;
+
+    return h;
+}
+
+/*
+ * Pointer to a column's data inside the mapped file, or NULL if the file
+ * is invalid, the column is absent, has an unknown type, is not on a
+ * GR_COLUMNAR_ALIGN boundary or runs past the end. out_count (optional)
+ * receives the number of elements; every type is 8 bytes.
+ */
+static inline const void* gr_columnar_column_data(
+    const void* base,
+    size_t      size,
+    uint32_t    id,
+    uint64_t*   out_count)
+{
+    const gr_columnar_header_t* h = gr_columnar_header(base, size);
+    if (!h) return NULL;
+
+    const gr_columnar_column_t* cols = (const gr_columnar_column_t*)(
+        (const char*)base + h->columns_offset);
+
+    for (uint32_t i = 0; i < h->num_columns; i++) {
+        if (cols[i].id != id) continue;
+        if (cols[i].type != GR_COLUMNAR_F64 && cols[i].type != GR_COLUMNAR_U64) return NULL;
+        if (cols[i].offset % GR_COLUMNAR_ALIGN != 0) return NULL;
+        if (!gr_columnar_fits(cols[i].offset, cols[i].count, 8u, size)) return NULL;
+        if (out_count) *out_count = cols[i].count;
+        return (const char*)base + cols[i].offset;
+    }
+
+    return NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GEORISK_COLUMNAR_H_INCLUDED */
@@ -0,0 +1,173 @@
+/**
+ * georisk_dual.h - Hyper-dual number arithmetic for exact derivatives
+ *
+ * A hyper-dual number carries a value and three infinitesimal parts:
+ *
+ *   x = re + e1·ε1 + e2·ε2 + e12·ε1ε2,   ε1² = ε2² = 0, ε1ε2 ≠ 0
+ *
+ * Evaluating f on x with e1 seeded along direction i and e2 along
+ * direction j yields, with no truncation error,
+ *
+ *   f(x).re  = f
+ *   f(x).e1  = ∂f/∂x_i
+ *   f(x).e2  = ∂f/∂x_j
+ *   f(x).e12 = ∂²f/∂x_i∂x_j
+ *
+ * Write a pricer against these helpers (gr_hyperdual_pricing_fn in
+ * georisk.h) and pass it to gr_jacobian_compute_hyperdual or
+ * gr_hessian_compute_hyperdual. There is no bump size to tune.
+ */
+
+#ifndef GEORISK_DUAL_H_INCLUDED
+#define GEORISK_DUAL_H_INCLUDED
+
+#include "georisk.h"
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Construction
+ * ============================================================================ */
+
+/* Constant: all infinitesimal parts zero */
+static inline gr_hyperdual_t gr_hd_const(double re)
+{
+    gr_hyperdual_t r = { re, 0.0, 0.0, 0.0 };
+    return r;
+}
+
+static inline gr_hyperdual_t gr_hd_make(double re, double e1, double e2, double e12)
+{
+    gr_hyperdual_t r = { re, e1, e2, e12 };
+    return r;
+}
+
+/* ============================================================================
+ * Arithmetic
+ * ============================================================================ */
+
+static inline gr_hyperdual_t gr_hd_add(gr_hyperdual_t x, gr_hyperdual_t y)
+{
+    return gr_hd_make(x.re + y.re, x.e1 + y.e1, x.e2 + y.e2, x.e12 + y.e12);
+}
+
+static inline gr_hyperdual_t gr_hd_sub(gr_hyperdual_t x, gr_hyperdual_t y)
+{
+    return gr_hd_make(x.re - y.re, x.e1 - y.e1, x.e2 - y.e2, x.e12 - y.e12);
+}
+
+static inline gr_hyperdual_t gr_hd_neg(gr_hyperdual_t x)
+{
+    return gr_hd_make(-x.re, -x.e1, -x.e2, -x.e12);
+}
+
+static inline gr_hyperdual_t gr_hd_scale(gr_hyperdual_t x, double s)
+{
+    return gr_hd_make(s * x.re, s * x.e1, s * x.e2, s * x.e12);
+}
+
+static inline gr_hyperdual_t gr_hd_add_const(gr_hyperdual_t x, double c)
+{
+    return gr_hd_make(x.re + c, x.e1, x.e2, x.e12);
+}
+
+static inline gr_hyperdual_t gr_hd_mul(gr_hyperdual_t x, gr_hyperdual_t y)
+{
+    return gr_hd_make(
+        x.re * y.re,
+        x.re * y.e1 + x.e1 * y.re,
+        x.re * y.e2 + x.e2 * y.re,
+        x.re * y.e12 + x.e1 * y.e2 + x.e2 * y.e1 + x.e12 * y.re
+    );
+}
+
+/*
+ * Apply a scalar function g given g(a), g'(a), g''(a) at a = x.re.
+ * Every elementary function below is a one-liner on top of this.
+ */
+static inline gr_hyperdual_t gr_hd_apply(gr_hyperdual_t x, double g0, double g1, double g2)
+{
+    return gr_hd_make(
+        g0,
+        g1 * x.e1,
+        g1 * x.e2,
+        g1 * x.e12 + g2 * x.e1 * x.e2
+    );
+}
+
+static inline gr_hyperdual_t gr_hd_inv(gr_hyperdual_t x)
+{
+    double r = 1.0 / x.re;
+    return gr_hd_apply(x, r, -r * r, 2.0 * r * r * r);
+}
+
+static inline gr_hyperdual_t gr_hd_div(gr_hyperdual_t x, gr_hyperdual_t y)
+{
+    return gr_hd_mul(x, gr_hd_inv(y));
+}
+
+/* ============================================================================
+ * Elementary Functions
+ * ============================================================================ */
+
+static inline gr_hyperdual_t gr_hd_exp(gr_hyperdual_t x)
+{
+    double e = exp(x.re);
+    return gr_hd_apply(x, e, e, e);
+}
+
+static inline gr_hyperdual_t gr_hd_log(gr_hyperdual_t x)
+{
+    double r = 1.0 / x.re;
+    return gr_hd_apply(x, log(x.re), r, -r * r);
+}
+
+static inline gr_hyperdual_t gr_hd_sqrt(gr_hyperdual_t x)
+{
+    double s = sqrt(x.re);
+    return gr_hd_apply(x, s, 0.5 / s, -0.25 / (s * x.re));
+}
+
+/* x^p for a constant exponent p */
+static inline gr_hyperdual_t gr_hd_pow(gr_hyperdual_t x, double p)
+{
+    double g0 = pow(x.re, p);
+    double g1 = p * pow(x.re, p - 1.0);
+    double g2 = p * (p - 1.0) * pow(x.re, p - 2.0);
+    return gr_hd_apply(x, g0, g1, g2);
+}
+
+static inline gr_hyperdual_t gr_hd_sin(gr_hyperdual_t x)
+{
+    double s = sin(x.re);
+    return gr_hd_apply(x, s, cos(x.re), -s);
+}
+
+static inline gr_hyperdual_t gr_hd_cos(gr_hyperdual_t x)
+{
+    double c = cos(x.re);
+    return gr_hd_apply(x, c, -sin(x.re), -c);
+}
+
+/* Standard normal CDF, the workhorse of closed-form option pricers */
+static inline gr_hyperdual_t gr_hd_norm_cdf(gr_hyperdual_t x)
+{
+    double pdf = 0.39894228040143267794 * exp(-0.5 * x.re * x.re);
+    double cdf = 0.5 * erfc(-x.re * 0.70710678118654752440);
+    return gr_hd_apply(x, cdf, pdf, -x.re * pdf);
+}
+
+/* Smooth everywhere except at x.re == y.re, where the branch is picked */
+static inline gr_hyperdual_t gr_hd_max(gr_hyperdual_t x, gr_hyperdual_t y)
+{
+    return (x.re >= y.re) ? x : y;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GEORISK_DUAL_H_INCLUDED */
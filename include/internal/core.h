@@ -28,6 +28,12 @@
 /* Maximum dimensions for state space */
 #define GR_MAX_DIMENSIONS 16
 
+/* Maximum registered adjoint pricers per context */
+#define GR_MAX_ADJOINTS 8
+
+/* Upper bound on worker threads for parallel analysis */
+#define GR_MAX_THREADS 64
+
 /* Maximum error message length */
 #define GR_MAX_ERROR_MSG 256
 
@@ -98,6 +104,14 @@ struct gr_context_s {
     /* Configuration */
     double bump_size;
     int    num_threads;
+    int    pricer_reentrant;   /* User pricers safe to call concurrently */
+    
+    /* Adjoint pricers keyed by the plain pricer they shadow */
+    struct {
+        gr_pricing_fn         fn;
+        gr_adjoint_pricing_fn adjoint;
+    } adjoints[GR_MAX_ADJOINTS];
+    int num_adjoints;
     
     /* Error state */
     gr_error_t last_error;
@@ -125,6 +139,18 @@ static inline void gr_set_error(gr_context_t* ctx, gr_error_t err, const char* m
     }
 }
 
+/* Adjoint registered for fn, or NULL */
+static inline gr_adjoint_pricing_fn gr_context_find_adjoint(
+    const gr_context_t* ctx,
+    gr_pricing_fn       fn)
+{
+    if (!ctx || !fn) return NULL;
+    for (int i = 0; i < ctx->num_adjoints; i++) {
+        if (ctx->adjoints[i].fn == fn) return ctx->adjoints[i].adjoint;
+    }
+    return NULL;
+}
+
 /* Clear error on context */
 static inline void gr_clear_error(gr_context_t* ctx) {
     if (ctx) {
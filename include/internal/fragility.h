@@ -10,23 +10,14 @@
 #include "state_space.h"
 #include "jacobian.h"
 #include "hessian.h"
+#include "constraints.h"
 #include <math.h>
 
 /* ============================================================================
  * Fragility Configuration
  * ============================================================================ */
 
-typedef struct gr_fragility_config {
-    double gradient_weight;
-    double curvature_weight;
-    double condition_weight;
-    double constraint_weight;
-    double gradient_scale;
-    double curvature_scale;
-    double condition_threshold;
-    double constraint_threshold;
-    double fragility_threshold;
-} gr_fragility_config_t;
+/* gr_fragility_config_t is public (georisk.h) */
 
 #define GR_FRAGILITY_CONFIG_DEFAULT { \
     0.25, 0.30, 0.25, 0.20,           \
@@ -34,24 +25,19 @@ typedef struct gr_fragility_config {
 }
 
 /* ============================================================================
- * Fragility Point
+ * Fragile Entry
+ *
+ * Fragile nodes are kept by flat index; coordinates live in one arena on
+ * the map that is filled once the list is final.
  * ============================================================================ */
 
-struct gr_fragility_point_s {
-    double* coordinates;
-    double  fragility_score;
-    double  curvature;
-    double  gradient_norm;
-    int     near_constraint;
-};
-
-static inline void gr_fragility_point_free(gr_fragility_point_t* pt, gr_context_t* ctx)
-{
-    if (pt->coordinates) {
-        gr_ctx_free(ctx, pt->coordinates);
-        pt->coordinates = NULL;
-    }
-}
+typedef struct gr_fragility_entry {
+    size_t flat;
+    double fragility_score;
+    double curvature;
+    double gradient_norm;
+    int    near_constraint;
+} gr_fragility_entry_t;
 
 /* ============================================================================
  * Fragility Map Structure
@@ -62,18 +48,64 @@ struct gr_fragility_map_s {
     gr_state_space_t*     space;
     gr_fragility_config_t config;
     
-    gr_fragility_point_t* points;
+    gr_fragility_entry_t* points;         /* Fragile nodes in flat order */
     size_t                num_points;
     size_t                capacity;
+    double*               point_coords;   /* num_points x num_dims arena */
+    size_t                coords_capacity;
+    size_t                num_fragile;    /* Nodes over threshold, kept or not */
+    size_t                top_k;          /* 0 keeps every fragile node */
     
     double*               grid_scores;
     int                   grid_computed;
     
+    const gr_constraint_surface_t* constraints; /* Borrowed, may be NULL */
+    double*               constraint_distance;  /* Signed distance per node */
+    
+    int                   cache_components;  /* Keep per-node components */
+    int                   components_valid;  /* Every node's components cached */
+    double*               gradient_grid;     /* Gradient norm per node */
+    double*               frobenius_grid;    /* Hessian Frobenius norm per node */
+    double*               condition_grid;    /* Hessian condition number per node */
+    
+    int                   screening;      /* Settle stable nodes by their bound */
+    size_t                num_screened;   /* Nodes settled without a solve */
+    size_t                num_eigen_solves; /* Solves in the last scan */
+    
     double                max_fragility;
+    double                sum_fragility;  /* Running total for incremental updates */
     double                mean_fragility;
     double                fragile_fraction;
+    
+    gr_fragility_cluster_t* clusters;     /* Connected fragile regions */
+    size_t                  num_clusters;
+    double*                 cluster_coords; /* 3 x num_dims per cluster */
 };
 
+static inline void gr_fragility_map_clear_clusters(gr_fragility_map_t* map)
+{
+    if (map->clusters) {
+        gr_ctx_free(map->ctx, map->clusters);
+        map->clusters = NULL;
+    }
+    if (map->cluster_coords) {
+        gr_ctx_free(map->ctx, map->cluster_coords);
+        map->cluster_coords = NULL;
+    }
+    map->num_clusters = 0;
+}
+
+static inline void gr_fragility_map_free_components(gr_fragility_map_t* map)
+{
+    if (map->gradient_grid) gr_ctx_free(map->ctx, map->gradient_grid);
+    if (map->frobenius_grid) gr_ctx_free(map->ctx, map->frobenius_grid);
+    if (map->condition_grid) gr_ctx_free(map->ctx, map->condition_grid);
+    map->gradient_grid = NULL;
+    map->frobenius_grid = NULL;
+    map->condition_grid = NULL;
+    map->components_valid = 0;
+}
+
 /* ============================================================================
  * Region Classification
  * ============================================================================ */
@@ -148,47 +180,29 @@ static inline double gr_fragility_combine(
     return score;
 }
 
-/* ============================================================================
- * Point Storage
- * ============================================================================ */
-
-static inline gr_error_t gr_fragility_map_add_point(
-    gr_fragility_map_t* map,
-    const double*       coords,
-    double              fragility,
-    double              curvature,
-    double              gradient_norm,
-    int                 near_constraint)
+/*
+ * Upper bound on the combined score using the condition bound in place
+ * of the exact condition number. The score is monotone in each component,
+ * so a non-negative condition weight keeps it a bound; with a negative
+ * weight the lowest possible component (0, condition >= 1) is used.
+ * Returns 2.0 (no bound) when the configuration is not monotone.
+ */
+static inline double gr_fragility_score_upper_bound(
+    double grad, double curv, double condition_ub, double cons,
+    const gr_fragility_config_t* cfg)
 {
-    gr_context_t* ctx = map->ctx;
-    int n = map->space->num_dims;
-    
-    if (map->num_points >= map->capacity) {
-        size_t new_cap = map->capacity == 0 ? 64 : map->capacity * 2;
-        gr_fragility_point_t* new_pts = (gr_fragility_point_t*)gr_ctx_realloc(
-            ctx, map->points, new_cap * sizeof(gr_fragility_point_t));
-        if (!new_pts) return GR_ERROR_OUT_OF_MEMORY;
-        map->points = new_pts;
-        map->capacity = new_cap;
-    }
+    if (cfg->condition_threshold <= 1.0) return 2.0;
     
-    gr_fragility_point_t* pt = &map->points[map->num_points];
+    double cond = (cfg->condition_weight >= 0.0)
+        ? gr_fragility_from_conditioning(condition_ub, cfg->condition_threshold)
+        : 0.0;
     
-    pt->coordinates = (double*)gr_ctx_malloc(ctx, (size_t)n * sizeof(double));
-    if (!pt->coordinates) return GR_ERROR_OUT_OF_MEMORY;
-    
-    for (int i = 0; i < n; i++) {
-        pt->coordinates[i] = coords[i];
-    }
-    
-    pt->fragility_score = fragility;
-    pt->curvature = curvature;
-    pt->gradient_norm = gradient_norm;
-    pt->near_constraint = near_constraint;
-    
-    map->num_points++;
+    double score = cfg->gradient_weight * grad
+                 + cfg->curvature_weight * curv
+                 + cfg->condition_weight * cond
+                 + cfg->constraint_weight * cons;
     
-    return GR_SUCCESS;
+    return score * (1.0 + 1e-12) + 1e-12;
 }
 
 #endif /* GR_INTERNAL_FRAGILITY_H */
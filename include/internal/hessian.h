@@ -23,8 +23,12 @@ struct gr_hessian_s {
     double*       data;
     double*       point;
     double*       eigenvalues;
+    double*       eigenvectors; /* n*n, column j pairs with eigenvalues[j] */
+    double*       scratch;     /* n*n eigen copy, 2n stencil, n*n warm-start (owned) */
     int           valid;
     int           eigen_valid;
+    int           warm_start;  /* Seed eigen-solves with the previous basis */
+    int           basis_valid; /* eigenvectors hold a usable basis */
 };
 
 /* ============================================================================
@@ -70,15 +74,14 @@ static inline double gr_hessian_compute_frobenius(const gr_hessian_t* h)
     return sqrt(sum);
 }
 
-static inline double gr_hessian_compute_condition(const gr_hessian_t* h)
+/* max|λ| / min|λ| over eigenvalues above 1e-15, as gr_hessian_condition_number */
+static inline double gr_condition_from_eigenvalues(const double* eigenvalues, int n)
 {
-    if (!h->eigen_valid) return 0.0;
-    
     double max_abs = 0.0;
     double min_abs = 1e300;
     
-    for (int i = 0; i < h->num_dims; i++) {
-        double abs_val = fabs(h->eigenvalues[i]);
+    for (int i = 0; i < n; i++) {
+        double abs_val = fabs(eigenvalues[i]);
         if (abs_val > max_abs) max_abs = abs_val;
         if (abs_val > 1e-15 && abs_val < min_abs) min_abs = abs_val;
     }
@@ -87,6 +90,48 @@ static inline double gr_hessian_compute_condition(const gr_hessian_t* h)
     return max_abs / min_abs;
 }
 
+static inline double gr_hessian_compute_condition(const gr_hessian_t* h)
+{
+    if (!h->eigen_valid) return 0.0;
+    return gr_condition_from_eigenvalues(h->eigenvalues, h->num_dims);
+}
+
+/*
+ * Upper bound on the condition number of symmetric H (n x n) without an
+ * eigen-solve. Gershgorin: every eigenvalue lies in a disc
+ * |λ - h_ii| <= r_i, so max|λ| <= min(max_i |h_ii| + r_i, ‖H‖_F) and,
+ * when no disc reaches zero, min|λ| >= min_i |h_ii| - r_i. A small slack
+ * covers the rounding of the eigen-solver the bound stands in for.
+ */
+static inline double gr_condition_upper_bound(const double* H, int n, double frobenius)
+{
+    double max_ub = 0.0;
+    double min_lb = 1e300;
+
+    for (int i = 0; i < n; i++) {
+        double diag = fabs(H[i * n + i]);
+        double radius = 0.0;
+        for (int j = 0; j < n; j++) {
+            if (j != i) radius += fabs(H[i * n + j]);
+        }
+        if (diag + radius > max_ub) max_ub = diag + radius;
+        if (diag - radius < min_lb) min_lb = diag - radius;
+    }
+
+    if (frobenius < max_ub) max_ub = frobenius;
+    max_ub = max_ub * (1.0 + 1e-9) + 1e-300;
+    min_lb -= 1e-9 * frobenius;
+
+    /* A disc touches zero: the solver's floor for min|λ| is 1e-15 */
+    if (min_lb <= 1e-15) return fmax(1e15, max_ub / 1e-15);
+    return fmax(1.0, max_ub / min_lb);
+}
+
+static inline double gr_hessian_condition_upper_bound(const gr_hessian_t* h, double frobenius)
+{
+    return gr_condition_upper_bound(h->data, h->num_dims, frobenius);
+}
+
 /* ============================================================================
  * Numerical Differentiation for Second Derivatives
  * ============================================================================ */
@@ -133,13 +178,20 @@ static inline double gr_second_partial_mixed(
 }
 
 /* ============================================================================
- * Jacobi Eigenvalue Algorithm (no nested functions)
+ * Cyclic Jacobi Eigen-Solver (no nested functions)
+ *
+ * Sweeps all off-diagonal pairs in row order instead of hunting for the
+ * largest element, so each rotation costs O(n) and the off-diagonal norm
+ * is only measured once per sweep. Early sweeps skip pairs below a
+ * threshold (Rutishauser), and pairs that have become negligible next to
+ * their diagonal are zeroed outright. Rotations are accumulated into V
+ * when requested, giving the eigenvectors as columns.
  * ============================================================================ */
 
-#define GR_JACOBI_MAX_ITER 100
+#define GR_JACOBI_MAX_SWEEPS 50
 #define GR_JACOBI_TOL 1e-12
 
-static inline double gr_jacobi_off_diag_norm(double* M, int n)
+static inline double gr_jacobi_off_diag_norm(const double* M, int n)
 {
     double sum = 0.0;
     for (int i = 0; i < n; i++) {
@@ -150,80 +202,208 @@ static inline double gr_jacobi_off_diag_norm(double* M, int n)
     return sqrt(2.0 * sum);
 }
 
-static inline void gr_jacobi_find_max_off_diag(double* M, int n, int* out_p, int* out_q)
+/* Apply the (p, q) rotation with tangent t to M (and V if non-NULL) */
+static inline void gr_jacobi_rotate(double* M, double* V, int n, int p, int q, double t)
 {
-    double max_val = 0.0;
-    *out_p = 0;
-    *out_q = 1;
-    
-    for (int i = 0; i < n; i++) {
+    double c = 1.0 / sqrt(t * t + 1.0);
+    double s = t * c;
+    double tau = s / (1.0 + c);
+    double apq = M[p * n + q];
+
+    M[p * n + p] -= t * apq;
+    M[q * n + q] += t * apq;
+    M[p * n + q] = 0.0;
+    M[q * n + p] = 0.0;
+
+    for (int k = 0; k < n; k++) {
+        if (k == p || k == q) continue;
+        double mkp = M[k * n + p];
+        double mkq = M[k * n + q];
+        M[k * n + p] = mkp - s * (mkq + tau * mkp);
+        M[k * n + q] = mkq + s * (mkp - tau * mkq);
+        M[p * n + k] = M[k * n + p];
+        M[q * n + k] = M[k * n + q];
+    }
+
+    if (V) {
+        for (int k = 0; k < n; k++) {
+            double vkp = V[k * n + p];
+            double vkq = V[k * n + q];
+            V[k * n + p] = vkp - s * (vkq + tau * vkp);
+            V[k * n + q] = vkq + s * (vkp - tau * vkq);
+        }
+    }
+}
+
+/*
+ * One cyclic sweep over all pairs. Pairs with |apq| < thresh are skipped;
+ * after the first few sweeps, pairs that no longer perturb either
+ * diagonal entry in floating point are set to zero.
+ */
+static inline void gr_jacobi_sweep(double* M, double* V, int n, double thresh, int sweep)
+{
+    for (int p = 0; p < n - 1; p++) {
+        for (int q = p + 1; q < n; q++) {
+            double apq = M[p * n + q];
+            double g = 100.0 * fabs(apq);
+            double app = M[p * n + p];
+            double aqq = M[q * n + q];
+
+            if (sweep > 3 && fabs(app) + g == fabs(app) && fabs(aqq) + g == fabs(aqq)) {
+                M[p * n + q] = 0.0;
+                M[q * n + p] = 0.0;
+                continue;
+            }
+            if (fabs(apq) <= thresh) continue;
+
+            double diff = aqq - app;
+            double t;
+            if (fabs(diff) + g == fabs(diff)) {
+                t = apq / diff;
+            } else {
+                double theta = 0.5 * diff / apq;
+                t = 1.0 / (fabs(theta) + sqrt(1.0 + theta * theta));
+                if (theta < 0.0) t = -t;
+            }
+
+            gr_jacobi_rotate(M, V, n, p, q, t);
+        }
+    }
+}
+
+/*
+ * Sort eigenvalues by |value| descending (carrying the columns of V
+ * along) and fix each eigenvector's sign so its largest component is
+ * positive, making the output deterministic.
+ */
+static inline void gr_jacobi_sort(double* eigenvalues, double* V, int n)
+{
+    for (int i = 0; i < n - 1; i++) {
+        int best = i;
         for (int j = i + 1; j < n; j++) {
-            double val = fabs(M[i * n + j]);
-            if (val > max_val) {
-                max_val = val;
-                *out_p = i;
-                *out_q = j;
+            if (fabs(eigenvalues[j]) > fabs(eigenvalues[best])) best = j;
+        }
+        if (best == i) continue;
+
+        double tmp = eigenvalues[i];
+        eigenvalues[i] = eigenvalues[best];
+        eigenvalues[best] = tmp;
+
+        if (V) {
+            for (int k = 0; k < n; k++) {
+                double v = V[k * n + i];
+                V[k * n + i] = V[k * n + best];
+                V[k * n + best] = v;
             }
         }
     }
+
+    if (!V) return;
+
+    for (int j = 0; j < n; j++) {
+        int arg = 0;
+        for (int k = 1; k < n; k++) {
+            if (fabs(V[k * n + j]) > fabs(V[arg * n + j])) arg = k;
+        }
+        if (V[arg * n + j] < 0.0) {
+            for (int k = 0; k < n; k++) V[k * n + j] = -V[k * n + j];
+        }
+    }
 }
 
-static inline gr_error_t gr_eigenvalues_jacobi(double* M, int n, double* eigenvalues)
+/* Sweep until the off-diagonal is negligible relative to the matrix scale */
+static inline gr_error_t gr_jacobi_solve(double* M, int n, double* eigenvalues, double* V)
 {
-    for (int iter = 0; iter < GR_JACOBI_MAX_ITER; iter++) {
+    double scale = 0.0;
+    for (int i = 0; i < n * n; i++) scale += M[i] * M[i];
+    scale = sqrt(scale);
+
+    for (int sweep = 0; sweep < GR_JACOBI_MAX_SWEEPS; sweep++) {
         double off = gr_jacobi_off_diag_norm(M, n);
-        if (off < GR_JACOBI_TOL) {
+
+        if (off <= GR_JACOBI_TOL * (scale > 1.0 ? scale : 1.0)) {
             for (int i = 0; i < n; i++) {
                 eigenvalues[i] = M[i * n + i];
             }
-            
-            for (int i = 0; i < n - 1; i++) {
-                for (int j = i + 1; j < n; j++) {
-                    if (fabs(eigenvalues[j]) > fabs(eigenvalues[i])) {
-                        double tmp = eigenvalues[i];
-                        eigenvalues[i] = eigenvalues[j];
-                        eigenvalues[j] = tmp;
-                    }
-                }
-            }
+            gr_jacobi_sort(eigenvalues, V, n);
             return GR_SUCCESS;
         }
-        
-        int p, q;
-        gr_jacobi_find_max_off_diag(M, n, &p, &q);
-        
-        double app = M[p * n + p];
-        double aqq = M[q * n + q];
-        double apq = M[p * n + q];
-        
-        double theta;
-        if (fabs(app - aqq) < 1e-15) {
-            theta = M_PI / 4.0;
-        } else {
-            theta = 0.5 * atan2(2.0 * apq, aqq - app);
+
+        /* Threshold on the mean off-diagonal magnitude for the first sweeps */
+        double thresh = (sweep < 3) ? 0.2 * off / (double)(n * n) : 0.0;
+        gr_jacobi_sweep(M, V, n, thresh, sweep);
+    }
+
+    return GR_ERROR_NUMERICAL_INSTABILITY;
+}
+
+/*
+ * Symmetric eigen-decomposition of M (n x n, destroyed). Eigenvalues come
+ * out sorted by |value| descending; if V is non-NULL it receives the
+ * matching unit eigenvectors as columns (V[k * n + j] is component k of
+ * eigenvector j).
+ */
+static inline gr_error_t gr_eigen_symmetric(double* M, int n, double* eigenvalues, double* V)
+{
+    if (V) {
+        for (int i = 0; i < n * n; i++) V[i] = 0.0;
+        for (int i = 0; i < n; i++) V[i * n + i] = 1.0;
+    }
+
+    return gr_jacobi_solve(M, n, eigenvalues, V);
+}
+
+/*
+ * Warm-started decomposition for scans over neighbouring matrices. On
+ * entry V holds the eigenvectors of a nearby matrix (the previous grid
+ * node). M is rotated into that basis, where it is already close to
+ * diagonal, so Jacobi only needs a sweep or two to finish; the new
+ * rotations are accumulated onto V. T is n*n workspace.
+ */
+static inline gr_error_t gr_eigen_symmetric_warm(
+    double* M, int n, double* eigenvalues, double* V, double* T)
+{
+    /* Re-orthonormalise the basis (modified Gram-Schmidt) against drift */
+    for (int j = 0; j < n; j++) {
+        for (int k = 0; k < j; k++) {
+            double dot = 0.0;
+            for (int r = 0; r < n; r++) dot += V[r * n + j] * V[r * n + k];
+            for (int r = 0; r < n; r++) V[r * n + j] -= dot * V[r * n + k];
+        }
+        double norm = 0.0;
+        for (int r = 0; r < n; r++) norm += V[r * n + j] * V[r * n + j];
+        norm = sqrt(norm);
+        if (norm < 1e-8) return gr_eigen_symmetric(M, n, eigenvalues, V);
+        for (int r = 0; r < n; r++) V[r * n + j] /= norm;
+    }
+
+    /* T = M V, then M = V^T T (symmetrised) */
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            double sum = 0.0;
+            for (int k = 0; k < n; k++) sum += M[r * n + k] * V[k * n + c];
+            T[r * n + c] = sum;
         }
-        
-        double c = cos(theta);
-        double s = sin(theta);
-        
-        for (int i = 0; i < n; i++) {
-            if (i != p && i != q) {
-                double Mip = M[i * n + p];
-                double Miq = M[i * n + q];
-                M[i * n + p] = c * Mip - s * Miq;
-                M[p * n + i] = M[i * n + p];
-                M[i * n + q] = s * Mip + c * Miq;
-                M[q * n + i] = M[i * n + q];
+    }
+    for (int r = 0; r < n; r++) {
+        for (int c = r; c < n; c++) {
+            double a = 0.0;
+            double b = 0.0;
+            for (int k = 0; k < n; k++) {
+                a += V[k * n + r] * T[k * n + c];
+                b += V[k * n + c] * T[k * n + r];
             }
+            M[r * n + c] = 0.5 * (a + b);
+            M[c * n + r] = M[r * n + c];
         }
-        
-        M[p * n + p] = c * c * app - 2 * s * c * apq + s * s * aqq;
-        M[q * n + q] = s * s * app + 2 * s * c * apq + c * c * aqq;
-        M[p * n + q] = 0.0;
-        M[q * n + p] = 0.0;
     }
-    
-    return GR_ERROR_NUMERICAL_INSTABILITY;
+
+    return gr_jacobi_solve(M, n, eigenvalues, V);
+}
+
+static inline gr_error_t gr_eigenvalues_jacobi(double* M, int n, double* eigenvalues)
+{
+    return gr_eigen_symmetric(M, n, eigenvalues, NULL);
 }
 
 #endif /* GR_INTERNAL_HESSIAN_H */
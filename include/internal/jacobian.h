@@ -18,6 +18,7 @@ struct gr_jacobian_s {
     double*       partials;    /* Partial derivatives */
     double*       point;       /* Evaluation point */
     double        value;       /* Function value at point */
+    double*       scratch;     /* Bump buffer, num_dims (owned) */
     int           valid;
 };
 
@@ -90,4 +91,13 @@ static inline double gr_partial_central(
     return (f_plus - f_minus) / (2.0 * h);
 }
 
+/* ============================================================================
+ * Richardson Extrapolation (Ridders)
+ * ============================================================================ */
+
+#define GR_RICHARDSON_MAX_LEVELS 16
+
+/* Stop once a new diagonal entry is this much worse than the best error */
+#define GR_RICHARDSON_SAFE 2.0
+
 #endif /* GR_INTERNAL_JACOBIAN_H */
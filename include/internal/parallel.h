@@ -0,0 +1,40 @@
+/**
+ * internal/parallel.h - Minimal fork/join parallel-for
+ *
+ * Spreads independent tasks over ctx->num_threads workers. The calling
+ * thread is worker 0; the rest are spawned per call and joined before
+ * returning, so no pool state outlives the call.
+ */
+
+#ifndef GR_INTERNAL_PARALLEL_H
+#define GR_INTERNAL_PARALLEL_H
+
+#include "georisk.h"
+#include "core.h"
+
+/* Task callback: index in [0, count), worker in [0, num_workers) */
+typedef void (*gr_parallel_task_fn)(size_t index, int worker, void* arg);
+
+/* Number of workers gr_parallel_for would use for `count` tasks */
+static inline int gr_parallel_num_workers(const gr_context_t* ctx, size_t count)
+{
+    int threads = (ctx && ctx->num_threads > 1) ? ctx->num_threads : 1;
+    if (threads > GR_MAX_THREADS) threads = GR_MAX_THREADS;
+    if ((size_t)threads > count) threads = (int)count;
+    return threads < 1 ? 1 : threads;
+}
+
+/*
+ * Run fn(i, worker, arg) for every i in [0, count). Tasks are handed out
+ * dynamically, so slow tasks do not stall a static partition. If a
+ * worker thread cannot be started its share is absorbed by the others.
+ * Implemented in parallel.c.
+ */
+void gr_parallel_for(
+    const gr_context_t* ctx,
+    size_t              count,
+    gr_parallel_task_fn fn,
+    void*               arg
+);
+
+#endif /* GR_INTERNAL_PARALLEL_H */
@@ -7,6 +7,7 @@
 
 #include "georisk.h"
 #include "allocator.h"
+#include <stddef.h>
 #include <string.h>
 #include <math.h>
 
@@ -40,6 +41,8 @@ struct gr_state_space_s {
     size_t                  strides[GR_MAX_DIMENSIONS];
     double*                 prices;
     int                     prices_valid;
+    double*                 gradients;      /* [total_points x num_dims], adjoint only */
+    int                     gradients_valid;
 };
 
 /* ============================================================================
@@ -154,7 +157,157 @@ static inline size_t gr_state_space_nearest_index(
     return gr_state_space_flat_index(space, indices);
 }
 
+/*
+ * Finite-difference step for a dimension: the grid spacing, so stencils
+ * land on sampled nodes of the interpolant. Falls back to the context
+ * bump size for degenerate dimensions.
+ */
+static inline double gr_state_space_grid_step(
+    const gr_state_space_t* space,
+    int                     d)
+{
+    const gr_dimension_internal_t* dim = &space->dims[d];
+
+    double hd = 0.0;
+    int np = dim->num_points;
+    double range = dim->max_value - dim->min_value;
+
+    if (np > 1 && fabs(range) > 1e-15) {
+        hd = range / (double)(np - 1);
+    } else {
+        hd = space->ctx->bump_size;
+        if (hd <= 0.0) hd = 0.01;
+    }
+
+    if (fabs(hd) < 1e-12) hd = 1e-6;
+    return hd;
+}
+
+/*
+ * Locate the grid cell containing val along dimension d by arithmetic on
+ * the uniform grid: cell index c in [0, num_points - 2] and fractional
+ * position t in [0, 1]. Out-of-range values clamp to the edge nodes
+ * before the conversion to int, so any finite or infinite val is safe;
+ * NaN lands on the lower edge.
+ */
+static inline void gr_state_space_locate_cell(
+    const gr_state_space_t* space,
+    int                     d,
+    double                  val,
+    int*                    out_cell,
+    double*                 out_t)
+{
+    const gr_dimension_internal_t* dim = &space->dims[d];
+    double h = (dim->max_value - dim->min_value) / (double)(dim->num_points - 1);
+    double u = (val - dim->min_value) / h;
+    double last = (double)(dim->num_points - 1);
+
+    if (!(u > 0.0)) u = 0.0;
+    if (u > last) u = last;
+
+    int c = (int)floor(u);
+    if (c > dim->num_points - 2) c = dim->num_points - 2;
+
+    double t = u - (double)c;
+    if (t > 1.0) t = 1.0;
+
+    *out_cell = c;
+    *out_t = t;
+}
+
+/*
+ * Flat offsets of the grid neighbours one step up and down each axis of
+ * the node at multi-index idx. At the edge the offset is 0, which clamps
+ * the stencil the same way the interpolant clamps coordinates.
+ */
+static inline void gr_state_space_neighbour_offsets(
+    const gr_state_space_t* space,
+    const int*              idx,
+    ptrdiff_t*              up,
+    ptrdiff_t*              dn)
+{
+    for (int d = 0; d < space->num_dims; d++) {
+        ptrdiff_t stride = (ptrdiff_t)space->strides[d];
+        up[d] = (idx[d] + 1 < space->dims[d].num_points) ? stride : 0;
+        dn[d] = (idx[d] > 0) ? -stride : 0;
+    }
+}
+
+/* Advance a multi-index to the next node in flat order (odometer step) */
+static inline void gr_state_space_next_index(const gr_state_space_t* space, int* idx)
+{
+    for (int d = space->num_dims - 1; d >= 0; d--) {
+        if (++idx[d] < space->dims[d].num_points) break;
+        idx[d] = 0;
+    }
+}
+
+/* Flat index of a point sitting exactly on grid nodes (uniform grid arithmetic) */
+static inline size_t gr_state_space_node_flat(
+    const gr_state_space_t* space,
+    const double*           coords)
+{
+    size_t flat = 0;
+    for (int d = 0; d < space->num_dims; d++) {
+        const gr_dimension_internal_t* dim = &space->dims[d];
+        double h = (dim->max_value - dim->min_value) / (double)(dim->num_points - 1);
+        long k = lround((coords[d] - dim->min_value) / h);
+        if (k < 0) k = 0;
+        if (k > dim->num_points - 1) k = dim->num_points - 1;
+        flat += (size_t)k * space->strides[d];
+    }
+    return flat;
+}
+
+/* Non-zero if [lo, hi] (inclusive, per dimension) is a valid index box */
+static inline int gr_state_space_box_valid(
+    const gr_state_space_t* space,
+    const int*              lo,
+    const int*              hi)
+{
+    for (int d = 0; d < space->num_dims; d++) {
+        if (lo[d] < 0 || hi[d] >= space->dims[d].num_points || lo[d] > hi[d]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Advance idx to the next node of the box [lo, hi] in flat order.
+ * Returns 0 once the box is exhausted.
+ */
+static inline int gr_state_space_next_in_box(
+    const gr_state_space_t* space,
+    int*                    idx,
+    const int*              lo,
+    const int*              hi)
+{
+    for (int d = space->num_dims - 1; d >= 0; d--) {
+        if (++idx[d] <= hi[d]) return 1;
+        idx[d] = lo[d];
+    }
+    return 0;
+}
+
 /* gr_state_space_interpolate_price is implemented in state_space.c */
 double gr_state_space_interpolate_price(const gr_state_space_t* space, const double* coords);
 
+/*
+ * Closed-form value, gradient and Hessian of the multilinear interpolant
+ * (state_space.c). out_grad [n] and out_hess [n*n] may be NULL.
+ */
+void gr_state_space_interpolant_derivatives(
+    const gr_state_space_t* space,
+    const double*           coords,
+    double*                 out_value,
+    double*                 out_grad,
+    double*                 out_hess);
+
+/* Interpolated adjoint gradient (state_space.c); needs gradients_valid */
+gr_error_t gr_state_space_interpolate_gradient(
+    const gr_state_space_t* space,
+    const double*           coords,
+    double*                 out);
+
 #endif /* GR_INTERNAL_STATE_SPACE_H */
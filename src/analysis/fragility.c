@@ -10,7 +10,9 @@
 #include "internal/jacobian.h"
 #include "internal/hessian.h"
 #include "internal/constraints.h"
+#include "internal/parallel.h"
 #include <string.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 
@@ -41,14 +43,36 @@ GR_API gr_fragility_map_t* gr_fragility_map_new(
     map->points = NULL;
     map->num_points = 0;
     map->capacity = 0;
+    map->point_coords = NULL;
+    map->coords_capacity = 0;
+    map->num_fragile = 0;
+    map->top_k = 0;
     
     map->grid_scores = NULL;
     map->grid_computed = 0;
     
+    map->constraints = NULL;
+    map->constraint_distance = NULL;
+    
+    map->cache_components = 0;
+    map->components_valid = 0;
+    map->gradient_grid = NULL;
+    map->frobenius_grid = NULL;
+    map->condition_grid = NULL;
+    
+    map->screening = 0;
+    map->num_screened = 0;
+    map->num_eigen_solves = 0;
+    
     map->max_fragility = 0.0;
+    map->sum_fragility = 0.0;
     map->mean_fragility = 0.0;
     map->fragile_fraction = 0.0;
     
+    map->clusters = NULL;
+    map->num_clusters = 0;
+    map->cluster_coords = NULL;
+    
     return map;
 }
 
@@ -58,25 +82,619 @@ GR_API void gr_fragility_map_free(gr_fragility_map_t* map)
     
     gr_context_t* ctx = map->ctx;
     
-    for (size_t i = 0; i < map->num_points; i++) {
-        gr_fragility_point_free(&map->points[i], ctx);
-    }
-    
     if (map->points) {
         gr_ctx_free(ctx, map->points);
     }
     
+    if (map->point_coords) {
+        gr_ctx_free(ctx, map->point_coords);
+    }
+    
     if (map->grid_scores) {
         gr_ctx_free(ctx, map->grid_scores);
     }
     
+    if (map->constraint_distance) {
+        gr_ctx_free(ctx, map->constraint_distance);
+    }
+    
+    gr_fragility_map_free_components(map);
+    gr_fragility_map_clear_clusters(map);
+    
     gr_ctx_free(ctx, map);
 }
 
+/* ============================================================================
+ * Fragile Point Storage
+ *
+ * Points are appended by flat index into one growing array, and their
+ * coordinates are written into a single arena when the list is final, so
+ * a scan costs O(log n) allocations however many nodes cross the
+ * threshold. With top_k set the array is a min-heap capped at k entries
+ * (ties keep the lower flat index) and is sorted back into flat order on
+ * finish; num_fragile still counts every node over threshold.
+ * ============================================================================ */
+
+static void fragility_points_reset(gr_fragility_map_t* map)
+{
+    map->num_points = 0;
+    map->num_fragile = 0;
+}
+
+/* Heap order: a sits below b if it is the weaker entry */
+static int fragility_entry_weaker(const gr_fragility_entry_t* a, const gr_fragility_entry_t* b)
+{
+    if (a->fragility_score != b->fragility_score) {
+        return a->fragility_score < b->fragility_score;
+    }
+    return a->flat > b->flat;
+}
+
+static void fragility_heap_sift_up(gr_fragility_entry_t* heap, size_t i)
+{
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!fragility_entry_weaker(&heap[i], &heap[parent])) break;
+        gr_fragility_entry_t tmp = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+static void fragility_heap_sift_down(gr_fragility_entry_t* heap, size_t count, size_t i)
+{
+    for (;;) {
+        size_t left = 2 * i + 1;
+        size_t right = left + 1;
+        size_t weakest = i;
+        if (left < count && fragility_entry_weaker(&heap[left], &heap[weakest])) weakest = left;
+        if (right < count && fragility_entry_weaker(&heap[right], &heap[weakest])) weakest = right;
+        if (weakest == i) break;
+        gr_fragility_entry_t tmp = heap[i];
+        heap[i] = heap[weakest];
+        heap[weakest] = tmp;
+        i = weakest;
+    }
+}
+
+static gr_error_t fragility_points_add(
+    gr_fragility_map_t*         map,
+    const gr_fragility_entry_t* entry)
+{
+    map->num_fragile++;
+    
+    if (map->top_k > 0 && map->num_points == map->top_k) {
+        if (fragility_entry_weaker(&map->points[0], entry)) {
+            map->points[0] = *entry;
+            fragility_heap_sift_down(map->points, map->num_points, 0);
+        }
+        return GR_SUCCESS;
+    }
+    
+    if (map->num_points >= map->capacity) {
+        size_t new_cap = map->capacity == 0 ? 64 : map->capacity * 2;
+        if (map->top_k > 0 && new_cap > map->top_k) new_cap = map->top_k;
+        gr_fragility_entry_t* grown = (gr_fragility_entry_t*)gr_ctx_realloc(
+            map->ctx, map->points, new_cap * sizeof(gr_fragility_entry_t));
+        if (!grown) return GR_ERROR_OUT_OF_MEMORY;
+        map->points = grown;
+        map->capacity = new_cap;
+    }
+    
+    map->points[map->num_points++] = *entry;
+    if (map->top_k > 0) {
+        fragility_heap_sift_up(map->points, map->num_points - 1);
+    }
+    
+    return GR_SUCCESS;
+}
+
+static int fragility_entry_flat_cmp(const void* a, const void* b)
+{
+    size_t fa = ((const gr_fragility_entry_t*)a)->flat;
+    size_t fb = ((const gr_fragility_entry_t*)b)->flat;
+    return (fa > fb) - (fa < fb);
+}
+
+static gr_error_t fragility_points_finish(gr_fragility_map_t* map)
+{
+    const gr_state_space_t* space = map->space;
+    size_t n = (size_t)space->num_dims;
+    
+    if (map->top_k > 0 && map->num_points > 1) {
+        qsort(map->points, map->num_points, sizeof(gr_fragility_entry_t),
+              fragility_entry_flat_cmp);
+    }
+    
+    if (map->num_points > map->coords_capacity) {
+        double* grown = (double*)gr_ctx_realloc(
+            map->ctx, map->point_coords, map->capacity * n * sizeof(double));
+        if (!grown) return GR_ERROR_OUT_OF_MEMORY;
+        map->point_coords = grown;
+        map->coords_capacity = map->capacity;
+    }
+    
+    for (size_t i = 0; i < map->num_points; i++) {
+        gr_state_space_get_coordinates(space, map->points[i].flat,
+                                       &map->point_coords[i * n]);
+    }
+    
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Constraint Distance Field
+ *
+ * The signed distance to the nearest active constraint, for every node.
+ * A threshold constraint on one dimension only varies along that axis,
+ * and one without a dimension is constant, so both collapse into a 1-D
+ * table per axis plus a scalar; the grid pass is then a min over n table
+ * lookups per node, split into blocks over ctx->num_threads. Only
+ * constraints with their own evaluation function are called per node,
+ * serially, since they carry no reentrancy guarantee. Each distance comes
+ * from gr_constraint_signed_distance, so the field matches
+ * gr_constraint_distance at every node.
+ * ============================================================================ */
+
+#define GR_CONSTRAINT_FIELD_BLOCK 4096
+
+typedef struct constraint_field_job {
+    const gr_state_space_t* space;
+    const double*           axis[GR_MAX_DIMENSIONS];   /* NULL if no constraint */
+    double                  constant;
+    double*                 out;
+} constraint_field_job_t;
+
+static void constraint_field_block(size_t block, int worker, void* arg)
+{
+    constraint_field_job_t* job = (constraint_field_job_t*)arg;
+    const gr_state_space_t* space = job->space;
+    int n = space->num_dims;
+    GR_UNUSED(worker);
+    
+    size_t begin = block * GR_CONSTRAINT_FIELD_BLOCK;
+    size_t end = begin + GR_CONSTRAINT_FIELD_BLOCK;
+    if (end > space->total_points) end = space->total_points;
+    
+    int idx[GR_MAX_DIMENSIONS];
+    gr_state_space_multi_index(space, begin, idx);
+    
+    for (size_t flat = begin; flat < end; flat++) {
+        double dist = job->constant;
+        for (int d = 0; d < n; d++) {
+            if (job->axis[d] && job->axis[d][idx[d]] < dist) dist = job->axis[d][idx[d]];
+        }
+        job->out[flat] = dist;
+        gr_state_space_next_index(space, idx);
+    }
+}
+
+static gr_error_t fragility_constraint_field(gr_fragility_map_t* map)
+{
+    gr_context_t* ctx = map->ctx;
+    const gr_state_space_t* space = map->space;
+    const gr_constraint_surface_t* surface = map->constraints;
+    int n = space->num_dims;
+    size_t total = space->total_points;
+    
+    if (!surface) {
+        if (map->constraint_distance) {
+            gr_ctx_free(ctx, map->constraint_distance);
+            map->constraint_distance = NULL;
+        }
+        return GR_SUCCESS;
+    }
+    
+    if (!map->constraint_distance) {
+        map->constraint_distance = (double*)gr_ctx_malloc(ctx, total * sizeof(double));
+        if (!map->constraint_distance) return GR_ERROR_OUT_OF_MEMORY;
+    }
+    
+    size_t table_size = 0;
+    for (int d = 0; d < n; d++) table_size += (size_t)space->dims[d].num_points;
+    double* tables = (double*)gr_ctx_malloc(ctx, table_size * sizeof(double));
+    if (!tables) return GR_ERROR_OUT_OF_MEMORY;
+    
+    constraint_field_job_t job;
+    job.space = space;
+    job.constant = 1e300;
+    job.out = map->constraint_distance;
+    
+    double* table = tables;
+    for (int d = 0; d < n; d++) {
+        job.axis[d] = NULL;
+        for (int i = 0; i < space->dims[d].num_points; i++) table[i] = 1e300;
+        table += space->dims[d].num_points;
+    }
+    
+    /* Fold separable constraints into per-axis tables and the constant */
+    double coords[GR_MAX_DIMENSIONS];
+    gr_state_space_get_coordinates(space, 0, coords);
+    int has_custom = 0;
+    
+    for (int c = 0; c < surface->num_constraints; c++) {
+        const gr_constraint_t* con = &surface->constraints[c];
+        if (!con->active) continue;
+        
+        if (con->eval_fn) {
+            has_custom = 1;
+        } else if (con->dimension >= 0 && con->dimension < n) {
+            int d = con->dimension;
+            double* axis = tables;
+            for (int e = 0; e < d; e++) axis += space->dims[e].num_points;
+            
+            double saved = coords[d];
+            for (int i = 0; i < space->dims[d].num_points; i++) {
+                coords[d] = space->dims[d].grid[i];
+                double dist = gr_constraint_signed_distance(con, coords, n);
+                if (dist < axis[i]) axis[i] = dist;
+            }
+            coords[d] = saved;
+            job.axis[d] = axis;
+        } else {
+            double dist = gr_constraint_signed_distance(con, coords, n);
+            if (dist < job.constant) job.constant = dist;
+        }
+    }
+    
+    size_t blocks = (total + GR_CONSTRAINT_FIELD_BLOCK - 1) / GR_CONSTRAINT_FIELD_BLOCK;
+    gr_parallel_for(ctx, blocks, constraint_field_block, &job);
+    gr_ctx_free(ctx, tables);
+    
+    if (has_custom) {
+        for (size_t flat = 0; flat < total; flat++) {
+            gr_state_space_get_coordinates(space, flat, coords);
+            for (int c = 0; c < surface->num_constraints; c++) {
+                const gr_constraint_t* con = &surface->constraints[c];
+                if (!con->active || !con->eval_fn) continue;
+                double dist = gr_constraint_signed_distance(con, coords, n);
+                if (dist < map->constraint_distance[flat]) {
+                    map->constraint_distance[flat] = dist;
+                }
+            }
+        }
+    }
+    
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Component Grids
+ * ============================================================================ */
+
+static gr_error_t fragility_components_prepare(gr_fragility_map_t* map)
+{
+    map->components_valid = 0;
+    if (!map->cache_components) return GR_SUCCESS;
+    
+    gr_context_t* ctx = map->ctx;
+    size_t bytes = map->space->total_points * sizeof(double);
+    
+    if (!map->gradient_grid) map->gradient_grid = (double*)gr_ctx_malloc(ctx, bytes);
+    if (!map->frobenius_grid) map->frobenius_grid = (double*)gr_ctx_malloc(ctx, bytes);
+    if (!map->condition_grid) map->condition_grid = (double*)gr_ctx_malloc(ctx, bytes);
+    
+    if (!map->gradient_grid || !map->frobenius_grid || !map->condition_grid) {
+        gr_fragility_map_free_components(map);
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Fused Node Kernel
+ *
+ * Scores a grid node straight from space->prices. The gradient and
+ * Hessian come from the node's clamped neighbour stencil (the same values
+ * gr_local_geometry_compute interpolates back out of the grid), are held
+ * in stack arrays, and feed the norms, condition number and combined
+ * score without building Jacobian or Hessian objects.
+ *
+ * Eigen-solves warm-start from an anchor: the first node of each run of
+ * GR_FRAGILITY_ANCHOR nodes in flat order is solved cold for its
+ * eigenbasis, and every other node of the run starts from that basis.
+ * A node's condition number then depends only on its own Hessian and its
+ * anchor's, not on which nodes were solved before it, so screening,
+ * chunking, thread count and configuration never change its bits.
+ * ============================================================================ */
+
+#define GR_FRAGILITY_ANCHOR 32
+
+typedef struct fragility_kernel {
+    const gr_fragility_map_t* map;
+    const gr_state_space_t*   space;
+    double                    h[GR_MAX_DIMENSIONS];
+    double                    basis[GR_MAX_DIMENSIONS * GR_MAX_DIMENSIONS];
+    size_t                    anchor;         /* Node the basis belongs to */
+    int                       basis_valid;
+    double                    anchor_condition;
+    int                       cache;          /* Write component grids */
+    int                       skip;           /* Settle screened nodes by their bound */
+    size_t                    num_solves;     /* Eigen-solves run by this kernel */
+} fragility_kernel_t;
+
+typedef struct fragility_node {
+    double score;
+    double gradient_norm;
+    double frobenius;
+    int    screened;
+    int    near_constraint;
+} fragility_node_t;
+
+static void fragility_kernel_init(fragility_kernel_t* k, const gr_fragility_map_t* map)
+{
+    k->map = map;
+    k->space = map->space;
+    k->anchor = (size_t)-1;
+    k->basis_valid = 0;
+    k->anchor_condition = 0.0;
+    k->cache = map->cache_components && map->gradient_grid != NULL;
+    k->skip = map->screening && !k->cache;
+    k->num_solves = 0;
+    for (int d = 0; d < map->space->num_dims; d++) {
+        k->h[d] = gr_state_space_grid_step(map->space, d);
+    }
+}
+
+/* Gradient norm squared and Hessian from the node's stencil */
+static double fragility_kernel_stencil(
+    const fragility_kernel_t* k,
+    size_t                    flat,
+    const int*                idx,
+    double*                   H)
+{
+    const gr_state_space_t* space = k->space;
+    const double* p = space->prices;
+    int n = space->num_dims;
+    
+    ptrdiff_t up[GR_MAX_DIMENSIONS];
+    ptrdiff_t dn[GR_MAX_DIMENSIONS];
+    gr_state_space_neighbour_offsets(space, idx, up, dn);
+    
+    ptrdiff_t c = (ptrdiff_t)flat;
+    double center = p[c];
+    double grad_sq = 0.0;
+    
+    for (int i = 0; i < n; i++) {
+        double f_plus = p[c + up[i]];
+        double f_minus = p[c + dn[i]];
+        double gi = (f_plus - f_minus) / (2.0 * k->h[i]);
+        grad_sq += gi * gi;
+        H[i * n + i] = (f_plus - 2.0 * center + f_minus) / (k->h[i] * k->h[i]);
+        
+        for (int j = i + 1; j < n; j++) {
+            double hij = (p[c + up[i] + up[j]] - p[c + up[i] + dn[j]] -
+                          p[c + dn[i] + up[j]] + p[c + dn[i] + dn[j]]) /
+                         (4.0 * k->h[i] * k->h[j]);
+            H[i * n + j] = hij;
+            H[j * n + i] = hij;
+        }
+    }
+    
+    return grad_sq;
+}
+
+/* Cold-solve the anchor of flat's run for its basis, once per run */
+static void fragility_kernel_anchor(fragility_kernel_t* k, size_t flat)
+{
+    size_t anchor = flat - flat % GR_FRAGILITY_ANCHOR;
+    if (k->anchor == anchor) return;
+    
+    int n = k->space->num_dims;
+    int idx[GR_MAX_DIMENSIONS] = {0};
+    double H[GR_MAX_DIMENSIONS * GR_MAX_DIMENSIONS];
+    double eigenvalues[GR_MAX_DIMENSIONS];
+    
+    gr_state_space_multi_index(k->space, anchor, idx);
+    fragility_kernel_stencil(k, anchor, idx, H);
+    
+    gr_error_t err = gr_eigen_symmetric(H, n, eigenvalues, k->basis);
+    k->num_solves++;
+    k->anchor = anchor;
+    k->basis_valid = (err == GR_SUCCESS);
+    
+    /* Same fallback as gr_hessian_condition_number on solver failure */
+    k->anchor_condition = k->basis_valid ? gr_condition_from_eigenvalues(eigenvalues, n) : 0.0;
+}
+
+static void fragility_kernel_eval(
+    fragility_kernel_t* k,
+    size_t              flat,
+    const int*          idx,
+    fragility_node_t*   out)
+{
+    const gr_fragility_config_t* cfg = &k->map->config;
+    int n = k->space->num_dims;
+    double H[GR_MAX_DIMENSIONS * GR_MAX_DIMENSIONS];
+    
+    double grad_sq = fragility_kernel_stencil(k, flat, idx, H);
+    
+    double frob_sq = 0.0;
+    for (int i = 0; i < n * n; i++) frob_sq += H[i] * H[i];
+    
+    out->gradient_norm = sqrt(grad_sq);
+    out->frobenius = sqrt(frob_sq);
+    out->screened = 0;
+    
+    if (k->cache) {
+        k->map->gradient_grid[flat] = out->gradient_norm;
+        k->map->frobenius_grid[flat] = out->frobenius;
+    }
+    
+    double grad_component = gr_fragility_from_gradient(out->gradient_norm, cfg->gradient_scale);
+    double curv_component = gr_fragility_from_curvature(out->frobenius, cfg->curvature_scale);
+    double cons_component = 0.0;
+    out->near_constraint = 0;
+    
+    if (k->map->constraint_distance) {
+        double distance = k->map->constraint_distance[flat];
+        cons_component = gr_fragility_from_constraint(distance, cfg->constraint_threshold);
+        out->near_constraint = distance < cfg->constraint_threshold;
+    }
+    
+    /* Settle nodes that provably stay below threshold without eigen-solving */
+    if (k->skip) {
+        double cond_ub = gr_condition_upper_bound(H, n, out->frobenius);
+        double bound = gr_fragility_score_upper_bound(
+            grad_component, curv_component, cond_ub, cons_component, cfg);
+        if (bound < cfg->fragility_threshold) {
+            out->screened = 1;
+            out->score = bound < 0.0 ? 0.0 : (bound > 1.0 ? 1.0 : bound);
+            return;
+        }
+    }
+    
+    fragility_kernel_anchor(k, flat);
+    
+    double condition;
+    if (flat == k->anchor) {
+        condition = k->anchor_condition;
+    } else {
+        double eigenvalues[GR_MAX_DIMENSIONS];
+        double V[GR_MAX_DIMENSIONS * GR_MAX_DIMENSIONS];
+        double T[GR_MAX_DIMENSIONS * GR_MAX_DIMENSIONS];
+        gr_error_t err;
+        
+        if (k->basis_valid) {
+            memcpy(V, k->basis, (size_t)(n * n) * sizeof(double));
+            err = gr_eigen_symmetric_warm(H, n, eigenvalues, V, T);
+        } else {
+            err = gr_eigen_symmetric(H, n, eigenvalues, NULL);
+        }
+        k->num_solves++;
+        condition = (err == GR_SUCCESS) ? gr_condition_from_eigenvalues(eigenvalues, n) : 0.0;
+    }
+    
+    if (k->cache) k->map->condition_grid[flat] = condition;
+    double cond_component = gr_fragility_from_conditioning(condition, cfg->condition_threshold);
+    
+    out->score = gr_fragility_combine(
+        grad_component, curv_component, cond_component, cons_component, cfg);
+}
+
+/*
+ * Screened nodes hold their bound, which can exceed the exact grid
+ * maximum when no node is fragile (otherwise a fragile score is above
+ * every bound). Walk the grid in flat order and rescore without skipping
+ * each node that would raise the running maximum, which gives exactly
+ * the unscreened score.
+ */
+static void fragility_settle_max(gr_fragility_map_t* map)
+{
+    fragility_kernel_t kernel;
+    fragility_kernel_init(&kernel, map);
+    if (!kernel.skip || map->num_fragile > 0) return;
+    kernel.skip = 0;
+    
+    const gr_state_space_t* space = map->space;
+    double max_fragility = 0.0;
+    int idx[GR_MAX_DIMENSIONS] = {0};
+    
+    for (size_t flat = 0; flat < space->total_points; flat++) {
+        if (map->grid_scores[flat] > max_fragility) {
+            fragility_node_t node;
+            fragility_kernel_eval(&kernel, flat, idx, &node);
+            if (node.score > max_fragility) max_fragility = node.score;
+        }
+        gr_state_space_next_index(space, idx);
+    }
+    
+    map->max_fragility = max_fragility;
+    map->num_eigen_solves += kernel.num_solves;
+}
+
 /* ============================================================================
  * Full Grid Fragility Computation
+ *
+ * The grid is cut into fixed chunks of GR_FRAGILITY_CHUNK nodes that run
+ * over ctx->num_threads workers. Fragile nodes go to per-chunk buffers
+ * that are merged in chunk order, and the summary statistics are reduced
+ * in flat order afterwards, so the result is bitwise identical for any
+ * thread count. Chunks are a whole number of anchor runs, so no warm
+ * start crosses a chunk boundary.
  * ============================================================================ */
 
+#define GR_FRAGILITY_CHUNK 1024
+
+typedef struct fragility_hit {
+    size_t flat;
+    double score;
+    double curvature;
+    double gradient_norm;
+    int    near_constraint;
+} fragility_hit_t;
+
+typedef struct fragility_chunk {
+    fragility_hit_t* hits;
+    size_t           num_hits;
+    size_t           capacity;
+    size_t           num_screened;
+    size_t           num_solves;
+    int              failed;
+} fragility_chunk_t;
+
+typedef struct fragility_scan_job {
+    gr_fragility_map_t* map;
+    fragility_chunk_t*  chunks;
+} fragility_scan_job_t;
+
+static void fragility_chunk_push(
+    gr_context_t*          ctx,
+    fragility_chunk_t*     chunk,
+    const fragility_hit_t* hit)
+{
+    if (chunk->num_hits >= chunk->capacity) {
+        size_t new_cap = chunk->capacity == 0 ? 16 : chunk->capacity * 2;
+        fragility_hit_t* grown = (fragility_hit_t*)gr_ctx_realloc(
+            ctx, chunk->hits, new_cap * sizeof(fragility_hit_t));
+        if (!grown) {
+            chunk->failed = 1;
+            return;
+        }
+        chunk->hits = grown;
+        chunk->capacity = new_cap;
+    }
+    chunk->hits[chunk->num_hits++] = *hit;
+}
+
+static void fragility_scan_chunk(size_t index, int worker, void* arg)
+{
+    fragility_scan_job_t* job = (fragility_scan_job_t*)arg;
+    gr_fragility_map_t* map = job->map;
+    gr_state_space_t* space = map->space;
+    fragility_chunk_t* chunk = &job->chunks[index];
+    GR_UNUSED(worker);
+    
+    size_t begin = index * GR_FRAGILITY_CHUNK;
+    size_t end = begin + GR_FRAGILITY_CHUNK;
+    if (end > space->total_points) end = space->total_points;
+    
+    fragility_kernel_t kernel;
+    fragility_kernel_init(&kernel, map);
+    
+    int idx[GR_MAX_DIMENSIONS];
+    gr_state_space_multi_index(space, begin, idx);
+    
+    for (size_t flat = begin; flat < end; flat++) {
+        fragility_node_t node;
+        fragility_kernel_eval(&kernel, flat, idx, &node);
+        gr_state_space_next_index(space, idx);
+        
+        map->grid_scores[flat] = node.score;
+        chunk->num_screened += (size_t)node.screened;
+        
+        if (node.score >= map->config.fragility_threshold) {
+            fragility_hit_t hit = {
+                flat, node.score, node.frobenius, node.gradient_norm, node.near_constraint
+            };
+            fragility_chunk_push(map->ctx, chunk, &hit);
+        }
+    }
+    
+    chunk->num_solves = kernel.num_solves;
+}
+
 GR_API gr_error_t gr_fragility_map_compute(gr_fragility_map_t* map)
 {
     if (!map) return GR_ERROR_NULL_POINTER;
@@ -90,7 +708,6 @@ GR_API gr_error_t gr_fragility_map_compute(gr_fragility_map_t* map)
     }
     
     size_t total = space->total_points;
-    int n = space->num_dims;
     
     if (!map->grid_scores) {
         map->grid_scores = (double*)gr_ctx_calloc(ctx, total, sizeof(double));
@@ -100,76 +717,650 @@ GR_API gr_error_t gr_fragility_map_compute(gr_fragility_map_t* map)
         }
     }
     
+    if (fragility_constraint_field(map) != GR_SUCCESS ||
+        fragility_components_prepare(map) != GR_SUCCESS) {
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate fragility component grids");
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+    
+    /* Cluster summaries describe the previous grid */
+    gr_fragility_map_clear_clusters(map);
+    fragility_points_reset(map);
+    
+    size_t num_chunks = (total + GR_FRAGILITY_CHUNK - 1) / GR_FRAGILITY_CHUNK;
+    
+    fragility_scan_job_t job;
+    job.map = map;
+    job.chunks = (fragility_chunk_t*)gr_ctx_calloc(ctx, num_chunks ? num_chunks : 1,
+                                                   sizeof(fragility_chunk_t));
+    
+    gr_error_t result = job.chunks ? GR_SUCCESS : GR_ERROR_OUT_OF_MEMORY;
+    
+    if (result == GR_SUCCESS) {
+        gr_parallel_for(ctx, num_chunks, fragility_scan_chunk, &job);
+    }
+    
+    /* Deterministic reduction: statistics in flat order, hits in chunk order */
     map->max_fragility = 0.0;
+    map->num_screened = 0;
+    map->num_eigen_solves = 0;
     double sum_fragility = 0.0;
-    size_t num_fragile = 0;
     
-    for (size_t i = 0; i < map->num_points; i++) {
-        gr_fragility_point_free(&map->points[i], ctx);
+    if (result == GR_SUCCESS) {
+        for (size_t flat = 0; flat < total; flat++) {
+            double fragility = map->grid_scores[flat];
+            sum_fragility += fragility;
+            if (fragility > map->max_fragility) {
+                map->max_fragility = fragility;
+            }
+        }
+        
+        for (size_t c = 0; c < num_chunks; c++) {
+            fragility_chunk_t* chunk = &job.chunks[c];
+            if (chunk->failed) result = GR_ERROR_OUT_OF_MEMORY;
+            map->num_screened += chunk->num_screened;
+            map->num_eigen_solves += chunk->num_solves;
+            
+            for (size_t h = 0; h < chunk->num_hits; h++) {
+                const fragility_hit_t* hit = &chunk->hits[h];
+                gr_fragility_entry_t entry = {
+                    hit->flat, hit->score, hit->curvature, hit->gradient_norm,
+                    hit->near_constraint
+                };
+                if (fragility_points_add(map, &entry) != GR_SUCCESS) {
+                    result = GR_ERROR_OUT_OF_MEMORY;
+                }
+            }
+        }
+        
+        if (result == GR_SUCCESS) result = fragility_points_finish(map);
     }
-    map->num_points = 0;
     
-    double coords[GR_MAX_DIMENSIONS];
+    if (job.chunks) {
+        for (size_t c = 0; c < num_chunks; c++) {
+            if (job.chunks[c].hits) gr_ctx_free(ctx, job.chunks[c].hits);
+        }
+        gr_ctx_free(ctx, job.chunks);
+    }
+    
+    if (result != GR_SUCCESS) {
+        gr_set_error(ctx, result, "Failed to allocate fragility scan workspaces");
+        return result;
+    }
     
-    gr_jacobian_t* jac = gr_jacobian_new(ctx, n);
-    gr_hessian_t* hess = gr_hessian_new(ctx, n);
+    map->sum_fragility = sum_fragility;
+    map->mean_fragility = (total > 0) ? sum_fragility / (double)total : 0.0;
+    map->fragile_fraction = (total > 0) ? (double)map->num_fragile / (double)total : 0.0;
+    map->grid_computed = 1;
+    map->components_valid = map->gradient_grid != NULL;
+    fragility_settle_max(map);
     
-    if (!jac || !hess) {
-        if (jac) gr_jacobian_free(jac);
-        if (hess) gr_hessian_free(hess);
-        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate analysis structures");
-        return GR_ERROR_OUT_OF_MEMORY;
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Incremental Update
+ *
+ * A node's score reads its neighbours up to one step away on every axis,
+ * so re-pricing the box [lo, hi] can only change scores in [lo-1, hi+1].
+ * Those nodes are rescored, the running sum and max are patched, and the
+ * fragile list is rebuilt by merging the untouched points with the new
+ * hits in flat order. The cost follows the size of the box plus the
+ * number of fragile points, not the grid.
+ * ============================================================================ */
+
+GR_API gr_error_t gr_fragility_map_update(
+    gr_fragility_map_t* map,
+    const int*          lo,
+    const int*          hi)
+{
+    if (!map) return GR_ERROR_NULL_POINTER;
+    if (!lo || !hi) return GR_ERROR_NULL_POINTER;
+    
+    gr_context_t* ctx = map->ctx;
+    gr_state_space_t* space = map->space;
+    int n = space->num_dims;
+    
+    if (!space->prices_valid) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED, "State space prices not computed");
+        return GR_ERROR_NOT_INITIALIZED;
     }
     
-    for (size_t flat = 0; flat < total; flat++) {
-        gr_state_space_get_coordinates(space, flat, coords);
+    if (!map->grid_computed) {
+        return gr_fragility_map_compute(map);
+    }
+    
+    if (!gr_state_space_box_valid(space, lo, hi)) {
+        gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT, "Index box outside the grid");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+    
+    /* A top-k list cannot tell which evicted nodes would return */
+    if (map->top_k > 0) {
+        return gr_fragility_map_compute(map);
+    }
+    
+    /* Grow the box by the stencil radius */
+    int a_lo[GR_MAX_DIMENSIONS];
+    int a_hi[GR_MAX_DIMENSIONS];
+    for (int d = 0; d < n; d++) {
+        a_lo[d] = lo[d] > 0 ? lo[d] - 1 : 0;
+        a_hi[d] = hi[d] + 1 < space->dims[d].num_points ? hi[d] + 1 : hi[d];
+    }
+    
+    gr_fragility_map_clear_clusters(map);
+    
+    /* Rescore in flat order, collecting new hits */
+    fragility_chunk_t fresh;
+    memset(&fresh, 0, sizeof(fresh));
+    
+    fragility_kernel_t kernel;
+    fragility_kernel_init(&kernel, map);
+    
+    double threshold = map->config.fragility_threshold;
+    int rescan_max = 0;
+    int idx[GR_MAX_DIMENSIONS];
+    for (int d = 0; d < n; d++) idx[d] = a_lo[d];
+    
+    do {
+        size_t flat = gr_state_space_flat_index(space, idx);
+        fragility_node_t node;
+        fragility_kernel_eval(&kernel, flat, idx, &node);
         
-        gr_error_t err = gr_jacobian_compute(jac, space, coords);
-        if (err != GR_SUCCESS) continue;
+        double old = map->grid_scores[flat];
+        map->grid_scores[flat] = node.score;
+        map->sum_fragility += node.score - old;
         
-        err = gr_hessian_compute(hess, space, coords);
-        if (err != GR_SUCCESS) continue;
+        if (node.score > map->max_fragility) {
+            map->max_fragility = node.score;
+        } else if (old == map->max_fragility && node.score < old) {
+            rescan_max = 1;
+        }
         
-        double gradient_norm = gr_jacobian_norm(jac);
-        double frobenius = gr_hessian_frobenius_norm(hess);
-        double condition = gr_hessian_condition_number(hess);
+        if (node.score >= threshold) {
+            fragility_hit_t hit = {
+                flat, node.score, node.frobenius, node.gradient_norm, node.near_constraint
+            };
+            fragility_chunk_push(ctx, &fresh, &hit);
+        }
+    } while (gr_state_space_next_in_box(space, idx, a_lo, a_hi));
+    
+    if (fresh.failed) {
+        if (fresh.hits) gr_ctx_free(ctx, fresh.hits);
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate fragile point buffer");
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+    
+    /* The previous maximum may have dropped: fall back to a plain scan */
+    if (rescan_max) {
+        map->max_fragility = 0.0;
+        for (size_t flat = 0; flat < space->total_points; flat++) {
+            if (map->grid_scores[flat] > map->max_fragility) {
+                map->max_fragility = map->grid_scores[flat];
+            }
+        }
+    }
+    
+    /* Merge surviving points and new hits, both already in flat order */
+    size_t old_count = map->num_points;
+    gr_fragility_entry_t* old_points = map->points;
+    
+    map->points = NULL;
+    map->capacity = 0;
+    fragility_points_reset(map);
+    
+    size_t h = 0;
+    gr_error_t result = GR_SUCCESS;
+    
+    for (size_t i = 0; i <= old_count; i++) {
+        size_t old_flat = (size_t)-1;
+        int inside = 0;
         
-        double grad_component = gr_fragility_from_gradient(gradient_norm, map->config.gradient_scale);
-        double curv_component = gr_fragility_from_curvature(frobenius, map->config.curvature_scale);
-        double cond_component = gr_fragility_from_conditioning(condition, map->config.condition_threshold);
-        double cons_component = 0.0;
+        if (i < old_count) {
+            old_flat = old_points[i].flat;
+            int pidx[GR_MAX_DIMENSIONS];
+            gr_state_space_multi_index(space, old_flat, pidx);
+            inside = 1;
+            for (int d = 0; d < n; d++) {
+                if (pidx[d] < a_lo[d] || pidx[d] > a_hi[d]) inside = 0;
+            }
+        }
         
-        double fragility = gr_fragility_combine(
-            grad_component, curv_component, cond_component, cons_component,
-            &map->config);
+        while (h < fresh.num_hits && fresh.hits[h].flat < old_flat) {
+            const fragility_hit_t* hit = &fresh.hits[h++];
+            gr_fragility_entry_t entry = {
+                hit->flat, hit->score, hit->curvature, hit->gradient_norm,
+                hit->near_constraint
+            };
+            if (fragility_points_add(map, &entry) != GR_SUCCESS) {
+                result = GR_ERROR_OUT_OF_MEMORY;
+            }
+        }
         
-        map->grid_scores[flat] = fragility;
+        if (i == old_count) break;
         
-        sum_fragility += fragility;
-        if (fragility > map->max_fragility) {
-            map->max_fragility = fragility;
+        if (!inside && fragility_points_add(map, &old_points[i]) != GR_SUCCESS) {
+            result = GR_ERROR_OUT_OF_MEMORY;
         }
+    }
+    
+    if (old_points) gr_ctx_free(ctx, old_points);
+    if (fresh.hits) gr_ctx_free(ctx, fresh.hits);
+    
+    if (result == GR_SUCCESS) result = fragility_points_finish(map);
+    
+    size_t total = space->total_points;
+    map->mean_fragility = (total > 0) ? map->sum_fragility / (double)total : 0.0;
+    map->fragile_fraction = (total > 0) ? (double)map->num_fragile / (double)total : 0.0;
+    map->num_eigen_solves = kernel.num_solves;
+    
+    if (result != GR_SUCCESS) {
+        gr_set_error(ctx, result, "Failed to allocate fragile points");
+        return result;
+    }
+    
+    fragility_settle_max(map);
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Multiresolution Search
+ *
+ * The grid is tiled into boxes of `stride` steps per axis. Each box
+ * scores its corners; if every corner sits below threshold - margin the
+ * interior is filled by multilinear interpolation of the corner scores,
+ * otherwise the box is halved along each axis and the halves are refined
+ * the same way, down to single cells. Only nodes actually scored can
+ * enter the fragile list; interpolated nodes contribute to the grid and
+ * the summary statistics as estimates. Scored nodes at or above threshold
+ * keep their components as they are evaluated, and are put back in flat
+ * order for the fragile list afterwards.
+ * ============================================================================ */
+
+typedef struct fragility_multires {
+    gr_fragility_map_t* map;
+    fragility_kernel_t  kernel;
+    unsigned char*      evaluated;
+    size_t              num_evaluated;
+    fragility_chunk_t   hits;       /* Fragile scored nodes, in visit order */
+    double              cutoff;     /* threshold - margin */
+} fragility_multires_t;
+
+static double multires_eval(fragility_multires_t* mr, const int* idx)
+{
+    gr_fragility_map_t* map = mr->map;
+    size_t flat = gr_state_space_flat_index(map->space, idx);
+    if (!mr->evaluated[flat]) {
+        fragility_node_t node;
+        fragility_kernel_eval(&mr->kernel, flat, idx, &node);
+        map->grid_scores[flat] = node.score;
+        map->num_screened += (size_t)node.screened;
+        mr->evaluated[flat] = 1;
+        mr->num_evaluated++;
         
-        if (fragility >= map->config.fragility_threshold) {
-            num_fragile++;
-            gr_fragility_map_add_point(map, coords, fragility, frobenius, gradient_norm, 0);
+        if (node.score >= map->config.fragility_threshold) {
+            fragility_hit_t hit = {
+                flat, node.score, node.frobenius, node.gradient_norm, node.near_constraint
+            };
+            fragility_chunk_push(map->ctx, &mr->hits, &hit);
+        }
+    }
+    return map->grid_scores[flat];
+}
+
+static int multires_hit_flat_cmp(const void* a, const void* b)
+{
+    size_t fa = ((const fragility_hit_t*)a)->flat;
+    size_t fb = ((const fragility_hit_t*)b)->flat;
+    return (fa > fb) - (fa < fb);
+}
+
+static void multires_box(fragility_multires_t* mr, const int* lo, const int* hi)
+{
+    const gr_state_space_t* space = mr->map->space;
+    int n = space->num_dims;
+    int idx[GR_MAX_DIMENSIONS];
+    
+    /* Corners */
+    int num_corners = 1 << n;
+    int all_stable = 1;
+    
+    for (int corner = 0; corner < num_corners; corner++) {
+        for (int d = 0; d < n; d++) idx[d] = ((corner >> d) & 1) ? hi[d] : lo[d];
+        if (multires_eval(mr, idx) >= mr->cutoff) all_stable = 0;
+    }
+    
+    int max_extent = 0;
+    for (int d = 0; d < n; d++) {
+        if (hi[d] - lo[d] > max_extent) max_extent = hi[d] - lo[d];
+    }
+    
+    if (max_extent <= 1) return;
+    
+    if (all_stable) {
+        /* Interpolate the interior from the corners */
+        for (int d = 0; d < n; d++) idx[d] = lo[d];
+        do {
+            size_t flat = gr_state_space_flat_index(space, idx);
+            if (mr->evaluated[flat]) continue;
+            
+            double value = 0.0;
+            for (int corner = 0; corner < num_corners; corner++) {
+                double w = 1.0;
+                int cidx[GR_MAX_DIMENSIONS];
+                for (int d = 0; d < n; d++) {
+                    int use_hi = (corner >> d) & 1;
+                    double t = (hi[d] > lo[d])
+                        ? (double)(idx[d] - lo[d]) / (double)(hi[d] - lo[d])
+                        : 0.0;
+                    w *= use_hi ? t : 1.0 - t;
+                    cidx[d] = use_hi ? hi[d] : lo[d];
+                }
+                if (w == 0.0) continue;
+                value += w * mr->map->grid_scores[gr_state_space_flat_index(space, cidx)];
+            }
+            mr->map->grid_scores[flat] = value;
+        } while (gr_state_space_next_in_box(space, idx, lo, hi));
+        return;
+    }
+    
+    /* Split every axis longer than one cell at its midpoint and recurse */
+    int split_dims[GR_MAX_DIMENSIONS];
+    int num_split = 0;
+    for (int d = 0; d < n; d++) {
+        if (hi[d] - lo[d] > 1) split_dims[num_split++] = d;
+    }
+    
+    for (int child = 0; child < (1 << num_split); child++) {
+        int clo[GR_MAX_DIMENSIONS];
+        int chi[GR_MAX_DIMENSIONS];
+        for (int d = 0; d < n; d++) {
+            clo[d] = lo[d];
+            chi[d] = hi[d];
+        }
+        for (int k = 0; k < num_split; k++) {
+            int d = split_dims[k];
+            int mid = lo[d] + (hi[d] - lo[d]) / 2;
+            if ((child >> k) & 1) clo[d] = mid;
+            else chi[d] = mid;
+        }
+        multires_box(mr, clo, chi);
+    }
+}
+
+GR_API gr_error_t gr_fragility_map_compute_multires(
+    gr_fragility_map_t* map,
+    int                 stride,
+    double              margin,
+    size_t*             out_evaluated)
+{
+    if (!map) return GR_ERROR_NULL_POINTER;
+    
+    gr_context_t* ctx = map->ctx;
+    gr_state_space_t* space = map->space;
+    int n = space->num_dims;
+    
+    if (!space->prices_valid) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED, "State space prices not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+    
+    if (stride < 1 || margin < 0.0) {
+        gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT,
+                     "Multiresolution stride must be >= 1 and margin >= 0");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+    
+    size_t total = space->total_points;
+    
+    if (!map->grid_scores) {
+        map->grid_scores = (double*)gr_ctx_calloc(ctx, total, sizeof(double));
+        if (!map->grid_scores) {
+            gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate fragility grid");
+            return GR_ERROR_OUT_OF_MEMORY;
         }
     }
     
+    if (fragility_constraint_field(map) != GR_SUCCESS) {
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate constraint distance field");
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+    
+    /* Interpolated nodes have no components to cache */
+    map->components_valid = 0;
+    gr_fragility_map_clear_clusters(map);
+    
+    fragility_multires_t mr;
+    mr.map = map;
+    mr.num_evaluated = 0;
+    memset(&mr.hits, 0, sizeof(mr.hits));
+    mr.cutoff = map->config.fragility_threshold - margin;
+    mr.evaluated = (unsigned char*)gr_ctx_calloc(ctx, total, sizeof(unsigned char));
+    if (!mr.evaluated) {
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate evaluation mask");
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+    fragility_kernel_init(&mr.kernel, map);
+    map->num_screened = 0;
+    
+    /* Tile the grid with stride-sized boxes (last one per axis truncated) */
+    int tiles[GR_MAX_DIMENSIONS];
+    int tile[GR_MAX_DIMENSIONS];
+    int zero[GR_MAX_DIMENSIONS];
+    for (int d = 0; d < n; d++) {
+        int cells = space->dims[d].num_points - 1;
+        tiles[d] = (cells + stride - 1) / stride - 1;
+        tile[d] = 0;
+        zero[d] = 0;
+    }
+    
+    do {
+        int lo[GR_MAX_DIMENSIONS];
+        int hi[GR_MAX_DIMENSIONS];
+        for (int d = 0; d < n; d++) {
+            lo[d] = tile[d] * stride;
+            hi[d] = lo[d] + stride;
+            if (hi[d] > space->dims[d].num_points - 1) hi[d] = space->dims[d].num_points - 1;
+        }
+        multires_box(&mr, lo, hi);
+    } while (gr_state_space_next_in_box(space, tile, zero, tiles));
+    
+    /* Statistics over the whole grid, fragile list from scored nodes only */
+    fragility_points_reset(map);
+    map->num_eigen_solves = mr.kernel.num_solves;
+    map->max_fragility = 0.0;
+    
+    double sum_fragility = 0.0;
+    gr_error_t result = mr.hits.failed ? GR_ERROR_OUT_OF_MEMORY : GR_SUCCESS;
+    
+    for (size_t flat = 0; flat < total; flat++) {
+        double fragility = map->grid_scores[flat];
+        sum_fragility += fragility;
+        if (fragility > map->max_fragility) map->max_fragility = fragility;
+    }
+    
+    if (result == GR_SUCCESS && mr.hits.num_hits > 1) {
+        qsort(mr.hits.hits, mr.hits.num_hits, sizeof(fragility_hit_t), multires_hit_flat_cmp);
+    }
+    
+    for (size_t i = 0; i < mr.hits.num_hits && result == GR_SUCCESS; i++) {
+        const fragility_hit_t* hit = &mr.hits.hits[i];
+        gr_fragility_entry_t entry = {
+            hit->flat, hit->score, hit->curvature, hit->gradient_norm, hit->near_constraint
+        };
+        result = fragility_points_add(map, &entry);
+    }
+    
+    gr_ctx_free(ctx, mr.evaluated);
+    if (mr.hits.hits) gr_ctx_free(ctx, mr.hits.hits);
+    
+    if (result == GR_SUCCESS) result = fragility_points_finish(map);
+    
+    map->sum_fragility = sum_fragility;
     map->mean_fragility = (total > 0) ? sum_fragility / (double)total : 0.0;
-    map->fragile_fraction = (total > 0) ? (double)num_fragile / (double)total : 0.0;
+    map->fragile_fraction = (total > 0) ? (double)map->num_fragile / (double)total : 0.0;
     map->grid_computed = 1;
     
-    gr_jacobian_free(jac);
-    gr_hessian_free(hess);
+    if (out_evaluated) *out_evaluated = mr.num_evaluated;
     
-    return GR_SUCCESS;
+    if (result != GR_SUCCESS) {
+        gr_set_error(ctx, result, "Failed to allocate fragile points");
+    }
+    return result;
+}
+
+/* ============================================================================
+ * Re-scoring from Cached Components
+ *
+ * With the component grids cached, a new configuration only changes the
+ * mapping of each component into [0, 1] and their weighted sum. Scores
+ * are recombined in parallel blocks through the same helpers the kernel
+ * uses, so a rescore matches a full compute under the new configuration;
+ * statistics and the fragile list follow in one flat-order pass.
+ * ============================================================================ */
+
+static void fragility_rescore_block(size_t block, int worker, void* arg)
+{
+    gr_fragility_map_t* map = (gr_fragility_map_t*)arg;
+    const gr_fragility_config_t* cfg = &map->config;
+    GR_UNUSED(worker);
+    
+    size_t begin = block * GR_FRAGILITY_CHUNK;
+    size_t end = begin + GR_FRAGILITY_CHUNK;
+    if (end > map->space->total_points) end = map->space->total_points;
+    
+    for (size_t flat = begin; flat < end; flat++) {
+        double grad = gr_fragility_from_gradient(map->gradient_grid[flat], cfg->gradient_scale);
+        double curv = gr_fragility_from_curvature(map->frobenius_grid[flat], cfg->curvature_scale);
+        double cond = gr_fragility_from_conditioning(map->condition_grid[flat],
+                                                     cfg->condition_threshold);
+        double cons = map->constraint_distance
+            ? gr_fragility_from_constraint(map->constraint_distance[flat],
+                                           cfg->constraint_threshold)
+            : 0.0;
+        map->grid_scores[flat] = gr_fragility_combine(grad, curv, cond, cons, cfg);
+    }
+}
+
+GR_API gr_error_t gr_fragility_map_rescore(
+    gr_fragility_map_t*          map,
+    const gr_fragility_config_t* config)
+{
+    if (!map || !config) return GR_ERROR_NULL_POINTER;
+    
+    gr_context_t* ctx = map->ctx;
+    
+    if (!map->grid_computed || !map->components_valid) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED,
+                     "Fragility components not cached; enable the cache and compute");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+    
+    map->config = *config;
+    gr_fragility_map_clear_clusters(map);
+    
+    size_t total = map->space->total_points;
+    size_t blocks = (total + GR_FRAGILITY_CHUNK - 1) / GR_FRAGILITY_CHUNK;
+    gr_parallel_for(ctx, blocks, fragility_rescore_block, map);
+    
+    fragility_points_reset(map);
+    map->num_screened = 0;
+    map->num_eigen_solves = 0;
+    map->max_fragility = 0.0;
+    
+    double sum_fragility = 0.0;
+    gr_error_t result = GR_SUCCESS;
+    
+    for (size_t flat = 0; flat < total; flat++) {
+        double fragility = map->grid_scores[flat];
+        sum_fragility += fragility;
+        if (fragility > map->max_fragility) map->max_fragility = fragility;
+        
+        if (fragility >= config->fragility_threshold) {
+            gr_fragility_entry_t entry = {
+                flat, fragility, map->frobenius_grid[flat], map->gradient_grid[flat],
+                map->constraint_distance &&
+                    map->constraint_distance[flat] < config->constraint_threshold
+            };
+            if (fragility_points_add(map, &entry) != GR_SUCCESS) {
+                result = GR_ERROR_OUT_OF_MEMORY;
+            }
+        }
+    }
+    
+    if (result == GR_SUCCESS) result = fragility_points_finish(map);
+    
+    map->sum_fragility = sum_fragility;
+    map->mean_fragility = (total > 0) ? sum_fragility / (double)total : 0.0;
+    map->fragile_fraction = (total > 0) ? (double)map->num_fragile / (double)total : 0.0;
+    
+    if (result != GR_SUCCESS) {
+        gr_set_error(ctx, result, "Failed to allocate fragile points");
+    }
+    return result;
 }
 
 /* ============================================================================
  * Fragility Map Accessors
  * ============================================================================ */
 
+GR_API void gr_fragility_map_set_screening(gr_fragility_map_t* map, int enable)
+{
+    if (!map) return;
+    map->screening = enable ? 1 : 0;
+}
+
+GR_API gr_error_t gr_fragility_map_set_config(
+    gr_fragility_map_t*          map,
+    const gr_fragility_config_t* config)
+{
+    if (!map || !config) return GR_ERROR_NULL_POINTER;
+    map->config = *config;
+    return GR_SUCCESS;
+}
+
+GR_API gr_error_t gr_fragility_map_get_config(
+    const gr_fragility_map_t* map,
+    gr_fragility_config_t*    out)
+{
+    if (!map || !out) return GR_ERROR_NULL_POINTER;
+    *out = map->config;
+    return GR_SUCCESS;
+}
+
+GR_API void gr_fragility_map_set_component_cache(gr_fragility_map_t* map, int enable)
+{
+    if (!map) return;
+    map->cache_components = enable ? 1 : 0;
+    if (!enable) gr_fragility_map_free_components(map);
+}
+
+GR_API void gr_fragility_map_set_constraints(
+    gr_fragility_map_t*            map,
+    const gr_constraint_surface_t* constraints)
+{
+    if (!map) return;
+    map->constraints = constraints;
+}
+
+GR_API void gr_fragility_map_set_top_k(gr_fragility_map_t* map, size_t k)
+{
+    if (!map) return;
+    map->top_k = k;
+}
+
+GR_API size_t gr_fragility_map_get_num_eigen_solves(const gr_fragility_map_t* map)
+{
+    if (!map) return 0;
+    return map->num_eigen_solves;
+}
+
+GR_API size_t gr_fragility_map_get_num_screened(const gr_fragility_map_t* map)
+{
+    if (!map) return 0;
+    return map->num_screened;
+}
+
 GR_API size_t gr_fragility_map_get_num_fragile_regions(const gr_fragility_map_t* map)
 {
     if (!map) return 0;
@@ -185,9 +1376,9 @@ GR_API gr_error_t gr_fragility_map_get_region(
     if (!out) return GR_ERROR_NULL_POINTER;
     if (index >= map->num_points) return GR_ERROR_INVALID_ARGUMENT;
     
-    const gr_fragility_point_t* src = &map->points[index];
+    const gr_fragility_entry_t* src = &map->points[index];
     
-    out->coordinates = src->coordinates;
+    out->coordinates = &map->point_coords[index * (size_t)map->space->num_dims];
     out->fragility_score = src->fragility_score;
     out->curvature = src->curvature;
     out->gradient_norm = src->gradient_norm;
@@ -196,6 +1387,24 @@ GR_API gr_error_t gr_fragility_map_get_region(
     return GR_SUCCESS;
 }
 
+GR_API double gr_fragility_map_get_max(const gr_fragility_map_t* map)
+{
+    if (!map || !map->grid_computed) return 0.0;
+    return map->max_fragility;
+}
+
+GR_API double gr_fragility_map_get_mean(const gr_fragility_map_t* map)
+{
+    if (!map || !map->grid_computed) return 0.0;
+    return map->mean_fragility;
+}
+
+GR_API double gr_fragility_map_get_fragile_fraction(const gr_fragility_map_t* map)
+{
+    if (!map || !map->grid_computed) return 0.0;
+    return map->fragile_fraction;
+}
+
 GR_API double gr_fragility_at_point(
     const gr_fragility_map_t* map,
     const double*             coordinates)
@@ -208,3 +1417,121 @@ GR_API double gr_fragility_at_point(
     
     return map->grid_scores[flat];
 }
+
+/* ============================================================================
+ * Interpolated Queries
+ *
+ * Multilinear interpolation of grid_scores. The bracketing cell comes
+ * from uniform-grid arithmetic (gr_state_space_locate_cell) rather than a
+ * scan of each axis, and axes where the point sits on a node drop out of
+ * the corner sum, so a query costs 2^k corner reads for the k axes where
+ * it falls strictly inside a cell, independent of the grid size.
+ * ============================================================================ */
+
+#define GR_FRAGILITY_QUERY_BLOCK 256
+
+static double fragility_interpolate(const gr_fragility_map_t* map, const double* coords)
+{
+    const gr_state_space_t* space = map->space;
+    const double* scores = map->grid_scores;
+    
+    size_t base = 0;
+    size_t step[GR_MAX_DIMENSIONS];
+    double t[GR_MAX_DIMENSIONS];
+    int active = 0;
+    
+    for (int d = 0; d < space->num_dims; d++) {
+        if (isnan(coords[d])) return NAN;
+        if (space->dims[d].num_points < 2) continue;
+        
+        int cell;
+        double td;
+        gr_state_space_locate_cell(space, d, coords[d], &cell, &td);
+        base += (size_t)cell * space->strides[d];
+        
+        if (td >= 1.0) {
+            base += space->strides[d];
+        } else if (td > 0.0) {
+            step[active] = space->strides[d];
+            t[active] = td;
+            active++;
+        }
+    }
+    
+    double value = 0.0;
+    size_t corners = (size_t)1 << active;
+    
+    for (size_t corner = 0; corner < corners; corner++) {
+        double w = 1.0;
+        size_t offset = base;
+        for (int a = 0; a < active; a++) {
+            if (corner & ((size_t)1 << a)) {
+                w *= t[a];
+                offset += step[a];
+            } else {
+                w *= 1.0 - t[a];
+            }
+        }
+        value += w * scores[offset];
+    }
+    
+    return value;
+}
+
+GR_API double gr_fragility_at_point_interpolated(
+    const gr_fragility_map_t* map,
+    const double*             coordinates)
+{
+    if (!map || !coordinates) return 0.0;
+    if (!map->grid_computed || !map->grid_scores) return 0.0;
+    
+    return fragility_interpolate(map, coordinates);
+}
+
+typedef struct fragility_query_job {
+    const gr_fragility_map_t* map;
+    const double*             coords;
+    size_t                    count;
+    double*                   out;
+} fragility_query_job_t;
+
+static void fragility_query_block(size_t block, int worker, void* arg)
+{
+    fragility_query_job_t* job = (fragility_query_job_t*)arg;
+    size_t n = (size_t)job->map->space->num_dims;
+    GR_UNUSED(worker);
+    
+    size_t begin = block * GR_FRAGILITY_QUERY_BLOCK;
+    size_t end = begin + GR_FRAGILITY_QUERY_BLOCK;
+    if (end > job->count) end = job->count;
+    
+    for (size_t i = begin; i < end; i++) {
+        job->out[i] = fragility_interpolate(job->map, &job->coords[i * n]);
+    }
+}
+
+GR_API gr_error_t gr_fragility_at_points_interpolated(
+    const gr_fragility_map_t* map,
+    const double*             coordinates,
+    size_t                    count,
+    double*                   out)
+{
+    if (!map) return GR_ERROR_NULL_POINTER;
+    if (count > 0 && (!coordinates || !out)) return GR_ERROR_NULL_POINTER;
+    
+    if (!map->grid_computed || !map->grid_scores) {
+        gr_set_error(map->ctx, GR_ERROR_NOT_INITIALIZED, "Fragility map not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+    
+    fragility_query_job_t job;
+    job.map = map;
+    job.coords = coordinates;
+    job.count = count;
+    job.out = out;
+    
+    size_t blocks = (count + GR_FRAGILITY_QUERY_BLOCK - 1) / GR_FRAGILITY_QUERY_BLOCK;
+    gr_parallel_for(map->ctx, blocks, fragility_query_block, &job);
+    
+    return GR_SUCCESS;
+}
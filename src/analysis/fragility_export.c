@@ -0,0 +1,241 @@
+/**
+ * fragility_export.c - Binary columnar export of fragility maps
+ *
+ * The file is written front to back in one pass: header, dimension table
+ * and column directory, then each column padded to GR_COLUMNAR_ALIGN.
+ * Offsets are all known up front from the column counts, so grid columns
+ * stream straight out of the map's arrays. Only the small tables stored
+ * interleaved in memory (fragile entries, cluster summaries) are gathered
+ * on the way out.
+ */
+
+#include "georisk.h"
+#include "georisk_columnar.h"
+#include "internal/core.h"
+#include "internal/fragility.h"
+#include "internal/state_space.h"
+#include <stdio.h>
+#include <string.h>
+
+#define GR_EXPORT_MAX_COLUMNS 16
+#define GR_EXPORT_BUFFER      512
+
+typedef struct export_writer {
+    FILE*    file;
+    uint64_t position;
+    int      failed;
+} export_writer_t;
+
+/* ============================================================================
+ * Stream Helpers
+ * ============================================================================ */
+
+static void export_write(export_writer_t* w, const void* data, size_t bytes)
+{
+    if (w->failed || bytes == 0) return;
+    if (fwrite(data, 1, bytes, w->file) != bytes) {
+        w->failed = 1;
+        return;
+    }
+    w->position += bytes;
+}
+
+static void export_pad_to(export_writer_t* w, uint64_t offset)
+{
+    static const char zeros[GR_COLUMNAR_ALIGN] = {0};
+    while (!w->failed && w->position < offset) {
+        uint64_t gap = offset - w->position;
+        export_write(w, zeros, gap < GR_COLUMNAR_ALIGN ? (size_t)gap : GR_COLUMNAR_ALIGN);
+    }
+}
+
+static uint64_t export_align(uint64_t offset)
+{
+    return (offset + GR_COLUMNAR_ALIGN - 1) / GR_COLUMNAR_ALIGN * GR_COLUMNAR_ALIGN;
+}
+
+/* ============================================================================
+ * Column Writers
+ * ============================================================================ */
+
+static void export_fragile_nodes(export_writer_t* w, const gr_fragility_map_t* map)
+{
+    uint64_t buf[GR_EXPORT_BUFFER];
+    size_t used = 0;
+
+    for (size_t i = 0; i < map->num_points; i++) {
+        buf[used++] = (uint64_t)map->points[i].flat;
+        if (used == GR_EXPORT_BUFFER) {
+            export_write(w, buf, used * sizeof(uint64_t));
+            used = 0;
+        }
+    }
+    export_write(w, buf, used * sizeof(uint64_t));
+}
+
+/* One cluster column, row by row out of the summary array */
+static void export_clusters(export_writer_t* w, const gr_fragility_map_t* map, uint32_t id)
+{
+    size_t n = (size_t)map->space->num_dims;
+
+    for (size_t c = 0; c < map->num_clusters; c++) {
+        const gr_fragility_cluster_t* cl = &map->clusters[c];
+        uint64_t volume = (uint64_t)cl->volume;
+
+        switch (id) {
+            case GR_COLUMN_CLUSTER_LOWER:
+                export_write(w, cl->lower, n * sizeof(double));
+                break;
+            case GR_COLUMN_CLUSTER_UPPER:
+                export_write(w, cl->upper, n * sizeof(double));
+                break;
+            case GR_COLUMN_CLUSTER_PEAK:
+                export_write(w, cl->peak, n * sizeof(double));
+                break;
+            case GR_COLUMN_CLUSTER_PEAK_SCORE:
+                export_write(w, &cl->peak_score, sizeof(double));
+                break;
+            case GR_COLUMN_CLUSTER_MEAN_SCORE:
+                export_write(w, &cl->mean_score, sizeof(double));
+                break;
+            case GR_COLUMN_CLUSTER_VOLUME:
+                export_write(w, &volume, sizeof(uint64_t));
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/* ============================================================================
+ * Public API
+ * ============================================================================ */
+
+GR_API gr_error_t gr_fragility_map_export(
+    const gr_fragility_map_t* map,
+    const char*               path)
+{
+    if (!map || !path) return GR_ERROR_NULL_POINTER;
+
+    gr_context_t* ctx = map->ctx;
+    const gr_state_space_t* space = map->space;
+    int n = space->num_dims;
+    uint64_t total = (uint64_t)space->total_points;
+
+    if (!map->grid_computed || !map->grid_scores) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED, "Fragility map not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+
+    /* Directory: grid data pointers for streamed columns, NULL otherwise */
+    gr_columnar_column_t cols[GR_EXPORT_MAX_COLUMNS];
+    const double* grid[GR_EXPORT_MAX_COLUMNS];
+    uint32_t num_cols = 0;
+
+#define GR_EXPORT_COLUMN(col_id, col_type, col_count, col_grid) \
+    do {                                                        \
+        cols[num_cols].id = (col_id);                           \
+        cols[num_cols].type = (col_type);                       \
+        cols[num_cols].offset = 0;                              \
+        cols[num_cols].count = (col_count);                     \
+        grid[num_cols] = (col_grid);                            \
+        num_cols++;                                             \
+    } while (0)
+
+    GR_EXPORT_COLUMN(GR_COLUMN_SCORES, GR_COLUMNAR_F64, total, map->grid_scores);
+
+    if (map->components_valid) {
+        GR_EXPORT_COLUMN(GR_COLUMN_GRADIENT_NORM, GR_COLUMNAR_F64, total, map->gradient_grid);
+        GR_EXPORT_COLUMN(GR_COLUMN_FROBENIUS, GR_COLUMNAR_F64, total, map->frobenius_grid);
+        GR_EXPORT_COLUMN(GR_COLUMN_CONDITION, GR_COLUMNAR_F64, total, map->condition_grid);
+    }
+    if (map->constraint_distance) {
+        GR_EXPORT_COLUMN(GR_COLUMN_CONSTRAINT_DISTANCE, GR_COLUMNAR_F64, total,
+                         map->constraint_distance);
+    }
+
+    GR_EXPORT_COLUMN(GR_COLUMN_FRAGILE_NODES, GR_COLUMNAR_U64,
+                     (uint64_t)map->num_points, NULL);
+
+    if (map->num_clusters > 0) {
+        uint64_t rows = (uint64_t)map->num_clusters;
+        GR_EXPORT_COLUMN(GR_COLUMN_CLUSTER_LOWER, GR_COLUMNAR_F64, rows * (uint64_t)n, NULL);
+        GR_EXPORT_COLUMN(GR_COLUMN_CLUSTER_UPPER, GR_COLUMNAR_F64, rows * (uint64_t)n, NULL);
+        GR_EXPORT_COLUMN(GR_COLUMN_CLUSTER_PEAK, GR_COLUMNAR_F64, rows * (uint64_t)n, NULL);
+        GR_EXPORT_COLUMN(GR_COLUMN_CLUSTER_PEAK_SCORE, GR_COLUMNAR_F64, rows, NULL);
+        GR_EXPORT_COLUMN(GR_COLUMN_CLUSTER_MEAN_SCORE, GR_COLUMNAR_F64, rows, NULL);
+        GR_EXPORT_COLUMN(GR_COLUMN_CLUSTER_VOLUME, GR_COLUMNAR_U64, rows, NULL);
+    }
+
+#undef GR_EXPORT_COLUMN
+
+    /* Layout */
+    gr_columnar_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GR_COLUMNAR_MAGIC, sizeof(header.magic));
+    header.version = GR_COLUMNAR_VERSION;
+    header.endian = GR_COLUMNAR_ENDIAN;
+    header.num_dims = (uint32_t)n;
+    header.num_columns = num_cols;
+    header.total_points = total;
+    header.num_clusters = (uint64_t)map->num_clusters;
+    header.num_fragile = (uint64_t)map->num_points;
+    header.dims_offset = sizeof(gr_columnar_header_t);
+    header.columns_offset = header.dims_offset +
+                            (uint64_t)n * sizeof(gr_columnar_dimension_t);
+    header.fragility_threshold = map->config.fragility_threshold;
+    header.max_fragility = map->max_fragility;
+    header.mean_fragility = map->mean_fragility;
+    header.fragile_fraction = map->fragile_fraction;
+
+    uint64_t offset = header.columns_offset + num_cols * sizeof(gr_columnar_column_t);
+    for (uint32_t c = 0; c < num_cols; c++) {
+        offset = export_align(offset);
+        cols[c].offset = offset;
+        offset += cols[c].count * 8u;
+    }
+
+    export_writer_t w;
+    w.file = fopen(path, "wb");
+    w.position = 0;
+    w.failed = 0;
+
+    if (!w.file) {
+        gr_set_error(ctx, GR_ERROR_IO, "Failed to open fragility export file");
+        return GR_ERROR_IO;
+    }
+
+    export_write(&w, &header, sizeof(header));
+
+    for (int d = 0; d < n; d++) {
+        gr_columnar_dimension_t dim;
+        dim.min_value = space->dims[d].min_value;
+        dim.max_value = space->dims[d].max_value;
+        dim.num_points = (uint64_t)space->dims[d].num_points;
+        dim.stride = (uint64_t)space->strides[d];
+        export_write(&w, &dim, sizeof(dim));
+    }
+
+    export_write(&w, cols, num_cols * sizeof(gr_columnar_column_t));
+
+    for (uint32_t c = 0; c < num_cols; c++) {
+        export_pad_to(&w, cols[c].offset);
+
+        if (grid[c]) {
+            export_write(&w, grid[c], (size_t)cols[c].count * sizeof(double));
+        } else if (cols[c].id == GR_COLUMN_FRAGILE_NODES) {
+            export_fragile_nodes(&w, map);
+        } else {
+            export_clusters(&w, map, cols[c].id);
+        }
+    }
+
+    if (fclose(w.file) != 0) w.failed = 1;
+
+    if (w.failed) {
+        gr_set_error(ctx, GR_ERROR_IO, "Failed to write fragility export file");
+        return GR_ERROR_IO;
+    }
+
+    return GR_SUCCESS;
+}
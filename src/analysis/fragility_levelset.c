@@ -0,0 +1,628 @@
+/**
+ * fragility_levelset.c - Level sets of the fragility score grid
+ *
+ * The fragile point list says which nodes are above threshold; plots and
+ * distance-to-fragility alerts need the boundary itself. Three extractors
+ * work on grid_scores, all treating score >= level as inside:
+ *
+ *   contour_2d     marching squares on a 2-D slice; ambiguous saddle
+ *                  cells are split by the cell-centre average
+ *   isosurface_3d  marching tetrahedra on a 3-D slice: each cube is cut
+ *                  into six tetrahedra around its main diagonal, which
+ *                  needs no 256-case table and leaves no ambiguous cases
+ *   boundary_cells every n-D cell whose corners straddle the level
+ *
+ * Slices fix every other axis at a caller-given index. Work is split by
+ * rows of cells along the first slice axis (or by flat blocks for the
+ * n-D enumeration) over ctx->num_threads; each block fills its own buffer
+ * and the buffers are concatenated in order, so output is identical for
+ * any thread count.
+ *
+ * Segments and triangles are indexed and unoriented. Every crossing lies
+ * on a grid edge, keyed by the edge's lower slice node and the corner
+ * bits it spans. Blocks record (key, point) pairs alongside the elements;
+ * the gather sorts the pairs by key and keeps one vertex per crossed
+ * edge. The lower corner always comes first when interpolating, so every
+ * cell sharing an edge computes the same bits for its crossing.
+ */
+
+#include "georisk.h"
+#include "internal/core.h"
+#include "internal/allocator.h"
+#include "internal/fragility.h"
+#include "internal/parallel.h"
+#include "internal/state_space.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define GR_LEVELSET_BLOCK 4096
+
+typedef struct levelset_buffer {
+    void*  data;
+    size_t count;
+    size_t capacity;
+    int    failed;
+} levelset_buffer_t;
+
+typedef struct levelset_vertex {
+    size_t key;                               /* Slice node * 8 + corner bits */
+    double point[3];
+} levelset_vertex_t;
+
+typedef struct levelset_job {
+    const gr_fragility_map_t* map;
+    int                       k;              /* Slice dimensionality */
+    int                       axis[3];
+    size_t                    slice_stride[3];
+    size_t                    base;           /* Flat offset of the fixed axes */
+    double                    level;
+    size_t                    element_size;   /* Bytes per output element */
+    const size_t*             corner_offset;  /* n-D cells only */
+    size_t                    num_corners;
+    levelset_buffer_t*        blocks;
+    levelset_buffer_t*        vertices;       /* Crossings, slices only */
+} levelset_job_t;
+
+/* ============================================================================
+ * Buffers
+ * ============================================================================ */
+
+static void* levelset_push(gr_context_t* ctx, levelset_buffer_t* buf, size_t element_size)
+{
+    if (buf->failed) return NULL;
+    if (buf->count >= buf->capacity) {
+        size_t new_cap = buf->capacity == 0 ? 64 : buf->capacity * 2;
+        void* grown = gr_ctx_realloc(ctx, buf->data, new_cap * element_size);
+        if (!grown) {
+            buf->failed = 1;
+            return NULL;
+        }
+        buf->data = grown;
+        buf->capacity = new_cap;
+    }
+    return (char*)buf->data + element_size * buf->count++;
+}
+
+/* Concatenate block buffers in order into one allocation */
+static gr_error_t levelset_gather(
+    gr_context_t*      ctx,
+    levelset_buffer_t* blocks,
+    size_t             num_blocks,
+    size_t             element_size,
+    void**             out_data,
+    size_t*            out_count)
+{
+    size_t total = 0;
+    gr_error_t result = GR_SUCCESS;
+
+    for (size_t b = 0; b < num_blocks; b++) {
+        if (blocks[b].failed) result = GR_ERROR_OUT_OF_MEMORY;
+        total += blocks[b].count;
+    }
+
+    char* data = NULL;
+    if (result == GR_SUCCESS && total > 0) {
+        data = (char*)gr_ctx_malloc(ctx, total * element_size);
+        if (!data) result = GR_ERROR_OUT_OF_MEMORY;
+    }
+
+    size_t at = 0;
+    for (size_t b = 0; b < num_blocks; b++) {
+        if (data && blocks[b].count > 0) {
+            memcpy(data + at * element_size, blocks[b].data, blocks[b].count * element_size);
+            at += blocks[b].count;
+        }
+        if (blocks[b].data) gr_ctx_free(ctx, blocks[b].data);
+    }
+    gr_ctx_free(ctx, blocks);
+
+    *out_data = data;
+    *out_count = (result == GR_SUCCESS) ? total : 0;
+    return result;
+}
+
+/* ============================================================================
+ * Slice Cells
+ * ============================================================================ */
+
+/* Corner c of the cell at idx: bit j steps one node along slice axis j */
+static size_t levelset_corner_flat(const levelset_job_t* job, const int* idx, int c)
+{
+    const gr_state_space_t* space = job->map->space;
+    size_t flat = job->base;
+    for (int j = 0; j < job->k; j++) {
+        flat += (size_t)(idx[j] + ((c >> j) & 1)) * space->strides[job->axis[j]];
+    }
+    return flat;
+}
+
+/* Point where the level crosses the edge between corners a and b */
+static void levelset_edge_point(
+    const levelset_job_t* job,
+    const int*            idx,
+    const double*         value,
+    int                   a,
+    int                   b,
+    double*               out)
+{
+    const gr_state_space_t* space = job->map->space;
+    double t = (job->level - value[a]) / (value[b] - value[a]);
+
+    for (int j = 0; j < job->k; j++) {
+        const double* grid = space->dims[job->axis[j]].grid;
+        double pa = grid[idx[j] + ((a >> j) & 1)];
+        double pb = grid[idx[j] + ((b >> j) & 1)];
+        out[j] = pa + t * (pb - pa);
+    }
+}
+
+/* Key the crossing on edge a-b of the cell and record its point */
+static size_t levelset_edge(
+    levelset_job_t* job,
+    size_t          row,
+    const int*      idx,
+    const double*   value,
+    int             a,
+    int             b)
+{
+    if (a > b) {
+        int swap = a;
+        a = b;
+        b = swap;
+    }
+
+    size_t node = 0;
+    for (int j = 0; j < job->k; j++) {
+        node += (size_t)(idx[j] + ((a >> j) & 1)) * job->slice_stride[j];
+    }
+    size_t key = node * 8 + (size_t)(a ^ b);
+
+    levelset_vertex_t* v = (levelset_vertex_t*)levelset_push(
+        job->map->ctx, &job->vertices[row], sizeof(levelset_vertex_t));
+    if (v) {
+        v->key = key;
+        levelset_edge_point(job, idx, value, a, b, v->point);
+    }
+    return key;
+}
+
+/* ============================================================================
+ * Marching Squares
+ * ============================================================================ */
+
+/*
+ * Corners are numbered by bits (x, y): 0 = (0,0), 1 = (1,0), 3 = (1,1),
+ * 2 = (0,1). Edges run around the square: 0-1, 1-3, 3-2, 2-0.
+ */
+static const int g_square_edge[4][2] = { {0, 1}, {1, 3}, {3, 2}, {2, 0} };
+
+/* Edge pairs per case (inside mask over corners 0, 1, 3, 2); -1 ends */
+static const int g_square_case[16][4] = {
+    {-1, -1, -1, -1}, { 3,  0, -1, -1}, { 0,  1, -1, -1}, { 3,  1, -1, -1},
+    { 1,  2, -1, -1}, {-1, -1, -1, -1}, { 0,  2, -1, -1}, { 3,  2, -1, -1},
+    { 2,  3, -1, -1}, { 0,  2, -1, -1}, {-1, -1, -1, -1}, { 1,  2, -1, -1},
+    { 3,  1, -1, -1}, { 0,  1, -1, -1}, { 3,  0, -1, -1}, {-1, -1, -1, -1}
+};
+
+static void levelset_square_row(size_t row, int worker, void* arg)
+{
+    levelset_job_t* job = (levelset_job_t*)arg;
+    const gr_state_space_t* space = job->map->space;
+    const double* scores = job->map->grid_scores;
+    levelset_buffer_t* buf = &job->blocks[row];
+    GR_UNUSED(worker);
+
+    int idx[2] = { (int)row, 0 };
+    int cells_y = space->dims[job->axis[1]].num_points - 1;
+
+    for (idx[1] = 0; idx[1] < cells_y; idx[1]++) {
+        double value[4];
+        for (int c = 0; c < 4; c++) value[c] = scores[levelset_corner_flat(job, idx, c)];
+
+        int mask = (value[0] >= job->level ? 1 : 0) | (value[1] >= job->level ? 2 : 0) |
+                   (value[3] >= job->level ? 4 : 0) | (value[2] >= job->level ? 8 : 0);
+
+        int pairs[4];
+        memcpy(pairs, g_square_case[mask], sizeof(pairs));
+
+        /* Saddles: the centre decides which diagonal pair is connected */
+        if (mask == 5 || mask == 10) {
+            int centre_inside = 0.25 * (value[0] + value[1] + value[2] + value[3]) >= job->level;
+            if ((mask == 5) == centre_inside) {
+                pairs[0] = 0; pairs[1] = 1; pairs[2] = 2; pairs[3] = 3;
+            } else {
+                pairs[0] = 3; pairs[1] = 0; pairs[2] = 1; pairs[3] = 2;
+            }
+        }
+
+        for (int s = 0; s < 4 && pairs[s] >= 0; s += 2) {
+            size_t* seg = (size_t*)levelset_push(job->map->ctx, buf, job->element_size);
+            if (!seg) return;
+            const int* e0 = g_square_edge[pairs[s]];
+            const int* e1 = g_square_edge[pairs[s + 1]];
+            seg[0] = levelset_edge(job, row, idx, value, e0[0], e0[1]);
+            seg[1] = levelset_edge(job, row, idx, value, e1[0], e1[1]);
+        }
+    }
+}
+
+/* ============================================================================
+ * Marching Tetrahedra
+ * ============================================================================ */
+
+/* Six tetrahedra sharing the diagonal 0-7, one per axis ordering */
+static const int g_cube_tet[6][4] = {
+    {0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7},
+    {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}
+};
+
+static void levelset_cube_row(size_t row, int worker, void* arg)
+{
+    levelset_job_t* job = (levelset_job_t*)arg;
+    const gr_state_space_t* space = job->map->space;
+    const double* scores = job->map->grid_scores;
+    levelset_buffer_t* buf = &job->blocks[row];
+    gr_context_t* ctx = job->map->ctx;
+    GR_UNUSED(worker);
+
+    int idx[3] = { (int)row, 0, 0 };
+    int cells_y = space->dims[job->axis[1]].num_points - 1;
+    int cells_z = space->dims[job->axis[2]].num_points - 1;
+
+    for (idx[1] = 0; idx[1] < cells_y; idx[1]++) {
+        for (idx[2] = 0; idx[2] < cells_z; idx[2]++) {
+            double value[8];
+            int inside = 0;
+            for (int c = 0; c < 8; c++) {
+                value[c] = scores[levelset_corner_flat(job, idx, c)];
+                if (value[c] >= job->level) inside |= 1 << c;
+            }
+            if (inside == 0 || inside == 0xff) continue;
+
+            for (int t = 0; t < 6; t++) {
+                const int* v = g_cube_tet[t];
+                int in[4], out[4];
+                int num_in = 0, num_out = 0;
+                for (int i = 0; i < 4; i++) {
+                    if (inside & (1 << v[i])) in[num_in++] = v[i];
+                    else                      out[num_out++] = v[i];
+                }
+                if (num_in == 0 || num_out == 0) continue;
+
+                if (num_in == 1 || num_out == 1) {
+                    /* One corner cut off: a single triangle */
+                    int apex = (num_in == 1) ? in[0] : out[0];
+                    const int* others = (num_in == 1) ? out : in;
+                    size_t* tri = (size_t*)levelset_push(ctx, buf, job->element_size);
+                    if (!tri) return;
+                    for (int i = 0; i < 3; i++) {
+                        tri[i] = levelset_edge(job, row, idx, value, apex, others[i]);
+                    }
+                } else {
+                    /* Two against two: the quad in0-out0, in0-out1, in1-out1, in1-out0 */
+                    size_t quad[4];
+                    quad[0] = levelset_edge(job, row, idx, value, in[0], out[0]);
+                    quad[1] = levelset_edge(job, row, idx, value, in[0], out[1]);
+                    quad[2] = levelset_edge(job, row, idx, value, in[1], out[1]);
+                    quad[3] = levelset_edge(job, row, idx, value, in[1], out[0]);
+
+                    for (int half = 0; half < 2; half++) {
+                        size_t* tri = (size_t*)levelset_push(ctx, buf, job->element_size);
+                        if (!tri) return;
+                        tri[0] = quad[0];
+                        tri[1] = quad[1 + half];
+                        tri[2] = quad[2 + half];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* ============================================================================
+ * Boundary Cells
+ * ============================================================================ */
+
+static void levelset_cell_block(size_t block, int worker, void* arg)
+{
+    levelset_job_t* job = (levelset_job_t*)arg;
+    const gr_state_space_t* space = job->map->space;
+    const double* scores = job->map->grid_scores;
+    levelset_buffer_t* buf = &job->blocks[block];
+    int n = space->num_dims;
+    GR_UNUSED(worker);
+
+    size_t begin = block * GR_LEVELSET_BLOCK;
+    size_t end = begin + GR_LEVELSET_BLOCK;
+    if (end > space->total_points) end = space->total_points;
+
+    int idx[GR_MAX_DIMENSIONS];
+    gr_state_space_multi_index(space, begin, idx);
+
+    for (size_t flat = begin; flat < end; flat++) {
+        int is_cell = 1;
+        for (int d = 0; d < n; d++) {
+            if (idx[d] + 1 >= space->dims[d].num_points) is_cell = 0;
+        }
+        gr_state_space_next_index(space, idx);
+        if (!is_cell) continue;
+
+        int any_in = 0, any_out = 0;
+        for (size_t c = 0; c < job->num_corners && !(any_in && any_out); c++) {
+            if (scores[flat + job->corner_offset[c]] >= job->level) any_in = 1;
+            else                                                    any_out = 1;
+        }
+
+        if (any_in && any_out) {
+            size_t* slot = (size_t*)levelset_push(job->map->ctx, buf, job->element_size);
+            if (!slot) return;
+            *slot = flat;
+        }
+    }
+}
+
+/* ============================================================================
+ * Vertex Welding
+ * ============================================================================ */
+
+static int levelset_vertex_cmp(const void* a, const void* b)
+{
+    size_t ka = ((const levelset_vertex_t*)a)->key;
+    size_t kb = ((const levelset_vertex_t*)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+/* Sort crossings by edge key, keep one per edge and rewrite keys as indices */
+static gr_error_t levelset_weld(
+    gr_context_t*      ctx,
+    int                k,
+    levelset_vertex_t* records,
+    size_t             num_records,
+    size_t*            indices,
+    size_t             num_indices,
+    gr_level_set_t*    out)
+{
+    size_t unique = 0;
+    if (num_records > 0) {
+        qsort(records, num_records, sizeof(*records), levelset_vertex_cmp);
+        for (size_t r = 0; r < num_records; r++) {
+            if (unique == 0 || records[r].key != records[unique - 1].key) {
+                records[unique++] = records[r];
+            }
+        }
+    }
+
+    double* vertices = NULL;
+    if (unique > 0) {
+        vertices = (double*)gr_ctx_malloc(ctx, unique * (size_t)k * sizeof(double));
+        if (!vertices) return GR_ERROR_OUT_OF_MEMORY;
+        for (size_t v = 0; v < unique; v++) {
+            memcpy(&vertices[v * (size_t)k], records[v].point, (size_t)k * sizeof(double));
+        }
+    }
+
+    for (size_t i = 0; i < num_indices; i++) {
+        size_t lo = 0;
+        size_t hi = unique;
+        while (hi - lo > 1) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (records[mid].key <= indices[i]) lo = mid;
+            else                                hi = mid;
+        }
+        indices[i] = lo;
+    }
+
+    out->vertices = vertices;
+    out->num_vertices = unique;
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Public API
+ * ============================================================================ */
+
+static gr_error_t levelset_slice(
+    const gr_fragility_map_t* map,
+    int                       k,
+    const int*                axis,
+    const int*                fixed,
+    double                    level,
+    gr_level_set_t*           out)
+{
+    if (!map || !axis || !out) return GR_ERROR_NULL_POINTER;
+
+    gr_context_t* ctx = map->ctx;
+    const gr_state_space_t* space = map->space;
+    int n = space->num_dims;
+
+    out->vertices = NULL;
+    out->num_vertices = 0;
+    out->indices = NULL;
+    out->num_elements = 0;
+    out->dims = k;
+
+    if (!map->grid_computed || !map->grid_scores) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED, "Fragility map not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+
+    int used[GR_MAX_DIMENSIONS] = {0};
+    for (int j = 0; j < k; j++) {
+        if (axis[j] < 0 || axis[j] >= n || used[axis[j]] ||
+            space->dims[axis[j]].num_points < 2) {
+            gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT,
+                         "Slice axes must be distinct dimensions with at least two nodes");
+            return GR_ERROR_INVALID_ARGUMENT;
+        }
+        used[axis[j]] = 1;
+    }
+
+    levelset_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.map = map;
+    job.k = k;
+    job.level = level;
+    job.element_size = (size_t)k * sizeof(size_t);
+    for (int j = 0; j < k; j++) job.axis[j] = axis[j];
+
+    job.slice_stride[k - 1] = 1;
+    for (int j = k - 2; j >= 0; j--) {
+        job.slice_stride[j] = job.slice_stride[j + 1] *
+                              (size_t)space->dims[axis[j + 1]].num_points;
+    }
+
+    for (int d = 0; d < n; d++) {
+        if (used[d]) continue;
+        int at = fixed ? fixed[d] : 0;
+        if (at < 0 || at >= space->dims[d].num_points) {
+            gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT, "Fixed slice index outside the grid");
+            return GR_ERROR_INVALID_ARGUMENT;
+        }
+        job.base += (size_t)at * space->strides[d];
+    }
+
+    size_t rows = (size_t)(space->dims[axis[0]].num_points - 1);
+    job.blocks = (levelset_buffer_t*)gr_ctx_calloc(ctx, rows, sizeof(levelset_buffer_t));
+    job.vertices = (levelset_buffer_t*)gr_ctx_calloc(ctx, rows, sizeof(levelset_buffer_t));
+    if (!job.blocks || !job.vertices) {
+        if (job.blocks) gr_ctx_free(ctx, job.blocks);
+        if (job.vertices) gr_ctx_free(ctx, job.vertices);
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate level set buffers");
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+
+    gr_parallel_for(ctx, rows, k == 2 ? levelset_square_row : levelset_cube_row, &job);
+
+    void* elements = NULL;
+    void* records = NULL;
+    size_t num_records = 0;
+    gr_error_t err = levelset_gather(ctx, job.blocks, rows, job.element_size,
+                                     &elements, &out->num_elements);
+    gr_error_t vert_err = levelset_gather(ctx, job.vertices, rows, sizeof(levelset_vertex_t),
+                                          &records, &num_records);
+    if (err == GR_SUCCESS) err = vert_err;
+
+    if (err == GR_SUCCESS) {
+        err = levelset_weld(ctx, k, (levelset_vertex_t*)records, num_records,
+                            (size_t*)elements, out->num_elements * (size_t)k, out);
+    }
+    if (records) gr_ctx_free(ctx, records);
+
+    if (err != GR_SUCCESS) {
+        if (elements) gr_ctx_free(ctx, elements);
+        out->num_elements = 0;
+        gr_set_error(ctx, err, "Failed to allocate level set buffers");
+        return err;
+    }
+
+    out->indices = (size_t*)elements;
+    return GR_SUCCESS;
+}
+
+GR_API gr_error_t gr_fragility_contour_2d(
+    const gr_fragility_map_t* map,
+    int                       axis_x,
+    int                       axis_y,
+    const int*                fixed,
+    double                    level,
+    gr_level_set_t*           out)
+{
+    int axis[2] = { axis_x, axis_y };
+    return levelset_slice(map, 2, axis, fixed, level, out);
+}
+
+GR_API gr_error_t gr_fragility_isosurface_3d(
+    const gr_fragility_map_t* map,
+    int                       axis_x,
+    int                       axis_y,
+    int                       axis_z,
+    const int*                fixed,
+    double                    level,
+    gr_level_set_t*           out)
+{
+    int axis[3] = { axis_x, axis_y, axis_z };
+    return levelset_slice(map, 3, axis, fixed, level, out);
+}
+
+GR_API void gr_level_set_free(const gr_fragility_map_t* map, gr_level_set_t* set)
+{
+    if (!map || !set) return;
+    if (set->vertices) gr_ctx_free(map->ctx, set->vertices);
+    if (set->indices) gr_ctx_free(map->ctx, set->indices);
+    set->vertices = NULL;
+    set->num_vertices = 0;
+    set->indices = NULL;
+    set->num_elements = 0;
+}
+
+GR_API gr_error_t gr_fragility_boundary_cells(
+    const gr_fragility_map_t* map,
+    double                    level,
+    gr_boundary_cells_t*      out)
+{
+    if (!map || !out) return GR_ERROR_NULL_POINTER;
+
+    gr_context_t* ctx = map->ctx;
+    const gr_state_space_t* space = map->space;
+    int n = space->num_dims;
+
+    out->cells = NULL;
+    out->num_cells = 0;
+
+    if (!map->grid_computed || !map->grid_scores) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED, "Fragility map not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+
+    /* A dimension with a single node has no cells */
+    for (int d = 0; d < n; d++) {
+        if (space->dims[d].num_points < 2) return GR_SUCCESS;
+    }
+
+    levelset_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.map = map;
+    job.level = level;
+    job.element_size = sizeof(size_t);
+    job.num_corners = (size_t)1 << n;
+
+    size_t* offsets = (size_t*)gr_ctx_malloc(ctx, job.num_corners * sizeof(size_t));
+    size_t blocks = (space->total_points + GR_LEVELSET_BLOCK - 1) / GR_LEVELSET_BLOCK;
+    job.blocks = (levelset_buffer_t*)gr_ctx_calloc(ctx, blocks ? blocks : 1,
+                                                   sizeof(levelset_buffer_t));
+    if (!offsets || !job.blocks) {
+        if (offsets) gr_ctx_free(ctx, offsets);
+        if (job.blocks) gr_ctx_free(ctx, job.blocks);
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate boundary cell buffers");
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (size_t c = 0; c < job.num_corners; c++) {
+        offsets[c] = 0;
+        for (int d = 0; d < n; d++) {
+            if (c & ((size_t)1 << d)) offsets[c] += space->strides[d];
+        }
+    }
+    job.corner_offset = offsets;
+
+    gr_parallel_for(ctx, blocks, levelset_cell_block, &job);
+    gr_ctx_free(ctx, offsets);
+
+    void* data = NULL;
+    gr_error_t err = levelset_gather(ctx, job.blocks, blocks, job.element_size,
+                                     &data, &out->num_cells);
+    out->cells = (size_t*)data;
+
+    if (err != GR_SUCCESS) {
+        gr_set_error(ctx, err, "Failed to allocate boundary cell buffers");
+    }
+    return err;
+}
+
+GR_API void gr_boundary_cells_free(const gr_fragility_map_t* map, gr_boundary_cells_t* cells)
+{
+    if (!map || !cells) return;
+    if (cells->cells) gr_ctx_free(map->ctx, cells->cells);
+    cells->cells = NULL;
+    cells->num_cells = 0;
+}
@@ -0,0 +1,246 @@
+/**
+ * fragility_regions.c - Connected fragile regions over the score grid
+ *
+ * The fragile point list holds one entry per node above threshold, which
+ * on a large grid is mostly the same few structures repeated node by
+ * node. Here the above-threshold nodes are labelled into connected
+ * components with union-find over face adjacency:
+ *
+ *   pass 1  every fragile node is joined with its fragile predecessor
+ *           along each axis; roots are always the lowest flat index, so
+ *           parent[x] <= x and the forest points backwards
+ *   pass 2  nodes are visited in flat order and each slot is overwritten
+ *           with its component label; a node's parent has already been
+ *           relabelled, so one lookup resolves it
+ *
+ * The label pass also accumulates each component's bounding box, peak,
+ * volume and score sum, so a handful of summaries replace the node list.
+ */
+
+#include "georisk.h"
+#include "internal/core.h"
+#include "internal/allocator.h"
+#include "internal/fragility.h"
+#include "internal/state_space.h"
+#include <stdint.h>
+
+#define GR_REGION_NONE SIZE_MAX
+
+typedef struct region_accum {
+    int    lo[GR_MAX_DIMENSIONS];
+    int    hi[GR_MAX_DIMENSIONS];
+    size_t peak_flat;
+    double peak_score;
+    double sum_score;
+    size_t volume;
+} region_accum_t;
+
+/* ============================================================================
+ * Union-Find
+ * ============================================================================ */
+
+static size_t region_find(size_t* parent, size_t x)
+{
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+static void region_union(size_t* parent, size_t a, size_t b)
+{
+    a = region_find(parent, a);
+    b = region_find(parent, b);
+    if (a == b) return;
+    if (a < b) parent[b] = a;
+    else       parent[a] = b;
+}
+
+/* ============================================================================
+ * Labelling
+ * ============================================================================ */
+
+static gr_error_t region_label(
+    const gr_fragility_map_t* map,
+    size_t*                   parent,
+    region_accum_t**          out_accum,
+    size_t*                   out_count)
+{
+    gr_context_t* ctx = map->ctx;
+    const gr_state_space_t* space = map->space;
+    const double* scores = map->grid_scores;
+    double threshold = map->config.fragility_threshold;
+    size_t total = space->total_points;
+    int n = space->num_dims;
+    int idx[GR_MAX_DIMENSIONS] = {0};
+
+    for (size_t flat = 0; flat < total; flat++) {
+        if (scores[flat] >= threshold) {
+            parent[flat] = flat;
+            for (int d = 0; d < n; d++) {
+                if (idx[d] == 0) continue;
+                size_t prev = flat - space->strides[d];
+                if (parent[prev] != GR_REGION_NONE) {
+                    region_union(parent, flat, prev);
+                }
+            }
+        } else {
+            parent[flat] = GR_REGION_NONE;
+        }
+        gr_state_space_next_index(space, idx);
+    }
+
+    /* Labels are stored as total + label so they never alias a node */
+    region_accum_t* accum = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+
+    for (size_t flat = 0; flat < total; flat++) {
+        if (parent[flat] == GR_REGION_NONE) {
+            gr_state_space_next_index(space, idx);
+            continue;
+        }
+
+        size_t label;
+        if (parent[flat] == flat) {
+            if (count >= capacity) {
+                size_t new_cap = capacity == 0 ? 16 : capacity * 2;
+                region_accum_t* grown = (region_accum_t*)gr_ctx_realloc(
+                    ctx, accum, new_cap * sizeof(region_accum_t));
+                if (!grown) {
+                    if (accum) gr_ctx_free(ctx, accum);
+                    return GR_ERROR_OUT_OF_MEMORY;
+                }
+                accum = grown;
+                capacity = new_cap;
+            }
+
+            label = count++;
+            region_accum_t* r = &accum[label];
+            for (int d = 0; d < n; d++) {
+                r->lo[d] = idx[d];
+                r->hi[d] = idx[d];
+            }
+            r->peak_flat = flat;
+            r->peak_score = scores[flat];
+            r->sum_score = 0.0;
+            r->volume = 0;
+        } else {
+            label = parent[parent[flat]] - total;
+        }
+        parent[flat] = total + label;
+
+        region_accum_t* r = &accum[label];
+        for (int d = 0; d < n; d++) {
+            if (idx[d] < r->lo[d]) r->lo[d] = idx[d];
+            if (idx[d] > r->hi[d]) r->hi[d] = idx[d];
+        }
+        if (scores[flat] > r->peak_score) {
+            r->peak_score = scores[flat];
+            r->peak_flat = flat;
+        }
+        r->sum_score += scores[flat];
+        r->volume++;
+
+        gr_state_space_next_index(space, idx);
+    }
+
+    *out_accum = accum;
+    *out_count = count;
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Public API
+ * ============================================================================ */
+
+GR_API gr_error_t gr_fragility_map_cluster(gr_fragility_map_t* map)
+{
+    if (!map) return GR_ERROR_NULL_POINTER;
+
+    gr_context_t* ctx = map->ctx;
+    const gr_state_space_t* space = map->space;
+
+    if (!map->grid_computed || !map->grid_scores) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED, "Fragility map not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+
+    gr_fragility_map_clear_clusters(map);
+
+    size_t* parent = (size_t*)gr_ctx_malloc(ctx, space->total_points * sizeof(size_t));
+    if (!parent) {
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate region labels");
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+
+    region_accum_t* accum = NULL;
+    size_t count = 0;
+    gr_error_t err = region_label(map, parent, &accum, &count);
+    gr_ctx_free(ctx, parent);
+
+    if (err != GR_SUCCESS) {
+        gr_set_error(ctx, err, "Failed to allocate region summaries");
+        return err;
+    }
+    if (count == 0) return GR_SUCCESS;
+
+    int n = space->num_dims;
+    map->clusters = (gr_fragility_cluster_t*)gr_ctx_malloc(
+        ctx, count * sizeof(gr_fragility_cluster_t));
+    map->cluster_coords = (double*)gr_ctx_malloc(
+        ctx, count * 3 * (size_t)n * sizeof(double));
+
+    if (!map->clusters || !map->cluster_coords) {
+        gr_fragility_map_clear_clusters(map);
+        gr_ctx_free(ctx, accum);
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate region summaries");
+        return GR_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (size_t c = 0; c < count; c++) {
+        const region_accum_t* r = &accum[c];
+        double* lower = &map->cluster_coords[c * 3 * (size_t)n];
+        double* upper = lower + n;
+        double* peak = upper + n;
+
+        for (int d = 0; d < n; d++) {
+            lower[d] = space->dims[d].grid[r->lo[d]];
+            upper[d] = space->dims[d].grid[r->hi[d]];
+        }
+        gr_state_space_get_coordinates(space, r->peak_flat, peak);
+
+        gr_fragility_cluster_t* out = &map->clusters[c];
+        out->lower = lower;
+        out->upper = upper;
+        out->peak = peak;
+        out->peak_score = r->peak_score;
+        out->mean_score = r->sum_score / (double)r->volume;
+        out->volume = r->volume;
+    }
+
+    map->num_clusters = count;
+    gr_ctx_free(ctx, accum);
+
+    return GR_SUCCESS;
+}
+
+GR_API size_t gr_fragility_map_get_num_clusters(const gr_fragility_map_t* map)
+{
+    if (!map) return 0;
+    return map->num_clusters;
+}
+
+GR_API gr_error_t gr_fragility_map_get_cluster(
+    const gr_fragility_map_t* map,
+    size_t                    index,
+    gr_fragility_cluster_t*   out)
+{
+    if (!map) return GR_ERROR_NULL_POINTER;
+    if (!out) return GR_ERROR_NULL_POINTER;
+    if (index >= map->num_clusters) return GR_ERROR_INVALID_ARGUMENT;
+
+    *out = map->clusters[index];
+    return GR_SUCCESS;
+}
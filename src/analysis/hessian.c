@@ -6,6 +6,7 @@
 #include "internal/core.h"
 #include "internal/allocator.h"
 #include "internal/hessian.h"
+#include "internal/parallel.h"
 #include "internal/state_space.h"
 #include <string.h>
 #include <math.h>
@@ -32,14 +33,22 @@ GR_API gr_hessian_t* gr_hessian_new(gr_context_t* ctx, int num_dims)
     hess->num_dims = num_dims;
     hess->valid = 0;
     hess->eigen_valid = 0;
+    hess->warm_start = 0;
+    hess->basis_valid = 0;
 
     size_t matrix_size = (size_t)num_dims * (size_t)num_dims;
 
     hess->data = (double*)gr_ctx_calloc(ctx, matrix_size, sizeof(double));
     hess->point = (double*)gr_ctx_calloc(ctx, (size_t)num_dims, sizeof(double));
     hess->eigenvalues = (double*)gr_ctx_calloc(ctx, (size_t)num_dims, sizeof(double));
+    hess->eigenvectors = (double*)gr_ctx_calloc(ctx, matrix_size, sizeof(double));
 
-    if (!hess->data || !hess->point || !hess->eigenvalues) {
+    /* Eigen-solver matrix copy, stencil point and steps, warm-start product */
+    hess->scratch = (double*)gr_ctx_calloc(
+        ctx, 2 * matrix_size + 2 * (size_t)num_dims, sizeof(double));
+
+    if (!hess->data || !hess->point || !hess->eigenvalues ||
+        !hess->eigenvectors || !hess->scratch) {
         gr_hessian_free(hess);
         gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate Hessian arrays");
         return NULL;
@@ -57,6 +66,8 @@ GR_API void gr_hessian_free(gr_hessian_t* hess)
     if (hess->data) gr_ctx_free(ctx, hess->data);
     if (hess->point) gr_ctx_free(ctx, hess->point);
     if (hess->eigenvalues) gr_ctx_free(ctx, hess->eigenvalues);
+    if (hess->eigenvectors) gr_ctx_free(ctx, hess->eigenvectors);
+    if (hess->scratch) gr_ctx_free(ctx, hess->scratch);
 
     gr_ctx_free(ctx, hess);
 }
@@ -93,12 +104,8 @@ GR_API gr_error_t gr_hessian_compute(
     /* Center value */
     double f_center = gr_state_space_interpolate_price(space, point);
 
-    /* Mutable copy of point */
-    double* x = (double*)gr_ctx_malloc(ctx, (size_t)n * sizeof(double));
-    if (!x) {
-        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate temp array");
-        return GR_ERROR_OUT_OF_MEMORY;
-    }
+    /* Mutable copy of point (scratch tail, past the eigen workspace) */
+    double* x = hess->scratch + (size_t)n * (size_t)n;
     for (int i = 0; i < n; i++) {
         x[i] = point[i];
     }
@@ -109,29 +116,10 @@ GR_API gr_error_t gr_hessian_compute(
      * Using ctx->bump_size blindly can mismatch the sampled grid and
      * explode second derivatives (exactly what your failing test showed).
      */
-    double* hstep = (double*)gr_ctx_malloc(ctx, (size_t)n * sizeof(double));
-    if (!hstep) {
-        gr_ctx_free(ctx, x);
-        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY, "Failed to allocate step array");
-        return GR_ERROR_OUT_OF_MEMORY;
-    }
+    double* hstep = x + n;
 
     for (int d = 0; d < n; d++) {
-        const gr_dimension_internal_t* dim = &space->dims[d];
-
-        double hd = 0.0;
-        int np = dim->num_points;
-        double range = dim->max_value - dim->min_value;
-
-        if (np > 1 && fabs(range) > 1e-15) {
-            hd = range / (double)(np - 1);
-        } else {
-            hd = ctx->bump_size;
-            if (hd <= 0.0) hd = 0.01;
-        }
-
-        if (fabs(hd) < 1e-12) hd = 1e-6;
-        hstep[d] = hd;
+        hstep[d] = gr_state_space_grid_step(space, d);
     }
 
     /* Diagonal terms */
@@ -181,8 +169,59 @@ GR_API gr_error_t gr_hessian_compute(
         }
     }
 
-    gr_ctx_free(ctx, hstep);
-    gr_ctx_free(ctx, x);
+    hess->valid = 1;
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Exact Hessian from a Hyper-Dual Pricer
+ * ============================================================================ */
+
+/*
+ * Seeding ε1 along axis i and ε2 along axis j makes f(x).e12 the exact
+ * mixed partial ∂²f/∂x_i∂x_j. The diagonal uses i == j. This costs
+ * n(n+1)/2 pricer calls, against 2n² + 1 for the bumped stencil, and
+ * carries no step-size error.
+ */
+GR_API gr_error_t gr_hessian_compute_hyperdual(
+    gr_hessian_t*           hess,
+    gr_hyperdual_pricing_fn fn,
+    void*                   user_data,
+    const double*           point)
+{
+    if (!hess || !fn || !point) {
+        return GR_ERROR_NULL_POINTER;
+    }
+
+    int n = hess->num_dims;
+    gr_hyperdual_t x[GR_MAX_DIMENSIONS];
+
+    for (int i = 0; i < n; i++) {
+        hess->point[i] = point[i];
+        x[i].re = point[i];
+        x[i].e1 = 0.0;
+        x[i].e2 = 0.0;
+        x[i].e12 = 0.0;
+    }
+
+    hess->eigen_valid = 0;
+
+    for (int i = 0; i < n; i++) {
+        x[i].e1 = 1.0;
+
+        for (int j = i; j < n; j++) {
+            x[j].e2 = 1.0;
+
+            gr_hyperdual_t f = fn(x, n, user_data);
+
+            x[j].e2 = 0.0;
+
+            hess->data[i * n + j] = f.e12;
+            hess->data[j * n + i] = f.e12;
+        }
+
+        x[i].e1 = 0.0;
+    }
 
     hess->valid = 1;
     return GR_SUCCESS;
@@ -201,6 +240,120 @@ GR_API double gr_hessian_get(const gr_hessian_t* hess, int row, int col)
     return hess->data[row * hess->num_dims + col];
 }
 
+/* ============================================================================
+ * Hessian-Vector Product on a Direct Pricer
+ * ============================================================================ */
+
+/*
+ * H v from gradients at x ± εv:
+ *
+ *   (H v)_i ≈ [f(x+εv+h e_i) - f(x+εv-h e_i) - f(x-εv+h e_i) + f(x-εv-h e_i)] / 4εh
+ *
+ * Task t evaluates one of those 4n points: t / 2n picks the side of v,
+ * (t % 2n) / 2 the axis and t % 2 the sign of the axial bump.
+ */
+typedef struct hvp_job {
+    gr_pricing_fn fn;
+    void*         user_data;
+    const double* point;
+    const double* v;
+    int           n;
+    double        h;
+    double        eps;
+    double*       values;
+} hvp_job_t;
+
+static void hvp_task(size_t index, int worker, void* arg)
+{
+    hvp_job_t* job = (hvp_job_t*)arg;
+    GR_UNUSED(worker);
+
+    int n = job->n;
+    size_t half = 2 * (size_t)n;
+    double side = (index < half) ? job->eps : -job->eps;
+    int axis = (int)((index % half) / 2);
+
+    double x[GR_MAX_DIMENSIONS];
+    for (int i = 0; i < n; i++) {
+        x[i] = job->point[i] + side * job->v[i];
+    }
+    x[axis] += (index % 2 == 0) ? job->h : -job->h;
+
+    job->values[index] = job->fn(x, n, job->user_data);
+}
+
+GR_API gr_error_t gr_hessian_vector_product_direct(
+    gr_context_t* ctx,
+    gr_pricing_fn fn,
+    void*         user_data,
+    const double* point,
+    const double* v,
+    int           num_dims,
+    double*       out)
+{
+    if (!ctx) return GR_ERROR_NULL_POINTER;
+    if (!fn || !point || !v || !out) return GR_ERROR_NULL_POINTER;
+
+    int n = num_dims;
+    if (n <= 0 || n > GR_MAX_DIMENSIONS) {
+        gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT, "Invalid number of dimensions");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+
+    double vnorm = 0.0;
+    for (int i = 0; i < n; i++) vnorm += v[i] * v[i];
+    vnorm = sqrt(vnorm);
+
+    if (vnorm == 0.0) {
+        for (int i = 0; i < n; i++) out[i] = 0.0;
+        return GR_SUCCESS;
+    }
+
+    /* Displace by one bump length along v whatever its scale */
+    double h = ctx->bump_size > 0.0 ? ctx->bump_size : 0.01;
+    double eps = h / vnorm;
+
+    /* Registered adjoint: two gradient calls in total */
+    gr_adjoint_pricing_fn adjoint = gr_context_find_adjoint(ctx, fn);
+    if (adjoint) {
+        double x[GR_MAX_DIMENSIONS];
+        double g_minus[GR_MAX_DIMENSIONS];
+
+        for (int i = 0; i < n; i++) x[i] = point[i] + eps * v[i];
+        adjoint(x, n, user_data, out);
+
+        for (int i = 0; i < n; i++) x[i] = point[i] - eps * v[i];
+        adjoint(x, n, user_data, g_minus);
+
+        for (int i = 0; i < n; i++) {
+            out[i] = (out[i] - g_minus[i]) / (2.0 * eps);
+        }
+        return GR_SUCCESS;
+    }
+
+    double values[4 * GR_MAX_DIMENSIONS];
+    hvp_job_t job = { fn, user_data, point, v, n, h, eps, values };
+    size_t count = 4 * (size_t)n;
+
+    if (ctx->pricer_reentrant && ctx->num_threads > 1) {
+        gr_parallel_for(ctx, count, hvp_task, &job);
+    } else {
+        for (size_t t = 0; t < count; t++) hvp_task(t, 0, &job);
+    }
+
+    size_t half = 2 * (size_t)n;
+    for (int i = 0; i < n; i++) {
+        size_t k = 2 * (size_t)i;
+        double f_pp = values[k];
+        double f_pm = values[k + 1];
+        double f_mp = values[half + k];
+        double f_mm = values[half + k + 1];
+        out[i] = (f_pp - f_pm - f_mp + f_mm) / (4.0 * eps * h);
+    }
+
+    return GR_SUCCESS;
+}
+
 /* ============================================================================
  * Eigenvalue Computation
  * ============================================================================ */
@@ -210,23 +363,23 @@ static gr_error_t compute_eigenvalues_internal(gr_hessian_t* hess)
     if (hess->eigen_valid) return GR_SUCCESS;
     if (!hess->valid) return GR_ERROR_NOT_INITIALIZED;
 
-    gr_context_t* ctx = hess->ctx;
     int n = hess->num_dims;
     size_t matrix_size = (size_t)n * (size_t)n;
 
-    double* M = (double*)gr_ctx_malloc(ctx, matrix_size * sizeof(double));
-    if (!M) return GR_ERROR_OUT_OF_MEMORY;
-
+    double* M = hess->scratch;
     memcpy(M, hess->data, matrix_size * sizeof(double));
 
-    gr_error_t err = gr_eigenvalues_jacobi(M, n, hess->eigenvalues);
-
-    gr_ctx_free(ctx, M);
-
-    if (err == GR_SUCCESS) {
-        hess->eigen_valid = 1;
+    gr_error_t err;
+    if (hess->warm_start && hess->basis_valid) {
+        double* T = hess->scratch + matrix_size + 2 * (size_t)n;
+        err = gr_eigen_symmetric_warm(M, n, hess->eigenvalues, hess->eigenvectors, T);
+    } else {
+        err = gr_eigen_symmetric(M, n, hess->eigenvalues, hess->eigenvectors);
     }
 
+    hess->eigen_valid = (err == GR_SUCCESS);
+    hess->basis_valid = (err == GR_SUCCESS);
+
     return err;
 }
 
@@ -250,6 +403,39 @@ GR_API gr_error_t gr_hessian_eigenvalues(
     return GR_SUCCESS;
 }
 
+GR_API gr_error_t gr_hessian_eigenvectors(
+    const gr_hessian_t* hess,
+    double*             eigenvalues,
+    double*             eigenvectors,
+    int                 num_vectors)
+{
+    if (!hess || !eigenvectors) return GR_ERROR_NULL_POINTER;
+    if (!hess->valid) return GR_ERROR_NOT_INITIALIZED;
+    if (num_vectors <= 0) return GR_ERROR_INVALID_ARGUMENT;
+
+    gr_error_t err = compute_eigenvalues_internal((gr_hessian_t*)hess);
+    if (err != GR_SUCCESS) return err;
+
+    int n = hess->num_dims;
+    int count = (num_vectors < n) ? num_vectors : n;
+
+    /* Internal storage is column-major per vector; hand out one row each */
+    for (int j = 0; j < count; j++) {
+        if (eigenvalues) eigenvalues[j] = hess->eigenvalues[j];
+        for (int k = 0; k < n; k++) {
+            eigenvectors[j * n + k] = hess->eigenvectors[k * n + j];
+        }
+    }
+
+    return GR_SUCCESS;
+}
+
+GR_API void gr_hessian_set_warm_start(gr_hessian_t* hess, int enable)
+{
+    if (!hess) return;
+    hess->warm_start = enable ? 1 : 0;
+}
+
 /* ============================================================================
  * Hessian Analysis Functions
  * ============================================================================ */
@@ -0,0 +1,126 @@
+/**
+ * hessian_field.c - Second-derivative grids over the whole state space
+ *
+ * Calling gr_hessian_compute at every node interpolates 2n² + 1 points
+ * per node, each interpolation walking 2^n corners, only to land back on
+ * grid nodes. This module reads the neighbours straight out of
+ * space->prices instead:
+ *
+ *   H_ii = (p[+e_i] - 2p + p[-e_i]) / h_i²
+ *   H_ij = (p[+e_i+e_j] - p[+e_i-e_j] - p[-e_i+e_j] + p[-e_i-e_j]) / 4h_i h_j
+ *
+ * Neighbour indices clamp at the grid edge exactly as the interpolant
+ * clamps out-of-range coordinates, so each node matches what
+ * gr_hessian_compute returns there. Nodes are independent and the sweep
+ * is split into blocks over ctx->num_threads.
+ */
+
+#include "georisk.h"
+#include "internal/core.h"
+#include "internal/parallel.h"
+#include "internal/state_space.h"
+#include <math.h>
+
+#define GR_HESSIAN_FIELD_BLOCK 4096
+
+typedef struct hessian_field_job {
+    const gr_state_space_t* space;
+    double                  h[GR_MAX_DIMENSIONS];
+    double*                 packed;
+    double*                 frobenius;
+    double*                 trace;
+} hessian_field_job_t;
+
+/* ============================================================================
+ * Node Stencil
+ * ============================================================================ */
+
+static void hessian_field_block(size_t block, int worker, void* arg)
+{
+    (void)worker;
+    hessian_field_job_t* job = (hessian_field_job_t*)arg;
+    const gr_state_space_t* space = job->space;
+    const double* p = space->prices;
+    int n = space->num_dims;
+    size_t packed_size = (size_t)n * (size_t)(n + 1) / 2;
+
+    size_t begin = block * GR_HESSIAN_FIELD_BLOCK;
+    size_t end = begin + GR_HESSIAN_FIELD_BLOCK;
+    if (end > space->total_points) end = space->total_points;
+
+    int idx[GR_MAX_DIMENSIONS];
+    gr_state_space_multi_index(space, begin, idx);
+
+    for (size_t node = begin; node < end; node++) {
+        ptrdiff_t up[GR_MAX_DIMENSIONS];
+        ptrdiff_t dn[GR_MAX_DIMENSIONS];
+        gr_state_space_neighbour_offsets(space, idx, up, dn);
+
+        double* out = job->packed ? &job->packed[node * packed_size] : NULL;
+        double center = p[node];
+        double tr = 0.0;
+        double frob = 0.0;
+        size_t e = 0;
+
+        for (int i = 0; i < n; i++) {
+            double hii = (p[(ptrdiff_t)node + up[i]] - 2.0 * center +
+                          p[(ptrdiff_t)node + dn[i]]) / (job->h[i] * job->h[i]);
+            if (out) out[e] = hii;
+            e++;
+            tr += hii;
+            frob += hii * hii;
+
+            for (int j = i + 1; j < n; j++) {
+                ptrdiff_t base = (ptrdiff_t)node;
+                double hij = (p[base + up[i] + up[j]] - p[base + up[i] + dn[j]] -
+                              p[base + dn[i] + up[j]] + p[base + dn[i] + dn[j]]) /
+                             (4.0 * job->h[i] * job->h[j]);
+                if (out) out[e] = hij;
+                e++;
+                frob += 2.0 * hij * hij;
+            }
+        }
+
+        if (job->trace) job->trace[node] = tr;
+        if (job->frobenius) job->frobenius[node] = sqrt(frob);
+
+        gr_state_space_next_index(space, idx);
+    }
+}
+
+/* ============================================================================
+ * Public API
+ * ============================================================================ */
+
+GR_API gr_error_t gr_state_space_hessian_field(
+    const gr_state_space_t* space,
+    double*                 out_packed,
+    double*                 out_frobenius,
+    double*                 out_trace)
+{
+    if (!space) return GR_ERROR_NULL_POINTER;
+    if (!out_packed && !out_frobenius && !out_trace) return GR_ERROR_NULL_POINTER;
+
+    gr_context_t* ctx = space->ctx;
+
+    if (!space->prices_valid) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED,
+                     "State space prices not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+
+    hessian_field_job_t job;
+    job.space = space;
+    job.packed = out_packed;
+    job.frobenius = out_frobenius;
+    job.trace = out_trace;
+    for (int d = 0; d < space->num_dims; d++) {
+        job.h[d] = gr_state_space_grid_step(space, d);
+    }
+
+    size_t blocks = (space->total_points + GR_HESSIAN_FIELD_BLOCK - 1) /
+                    GR_HESSIAN_FIELD_BLOCK;
+    gr_parallel_for(ctx, blocks, hessian_field_block, &job);
+
+    return GR_SUCCESS;
+}
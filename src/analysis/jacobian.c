@@ -21,6 +21,7 @@
 #include "internal/allocator.h"
 #include "internal/jacobian.h"
 #include "internal/state_space.h"
+#include "internal/parallel.h"
 #include <string.h>
 #include <math.h>
 
@@ -69,6 +70,17 @@ GR_API gr_jacobian_t* gr_jacobian_new(gr_context_t* ctx, int num_dims)
         return NULL;
     }
     
+    /* Preallocated bump buffer so compute calls never touch the heap */
+    jac->scratch = (double*)gr_ctx_calloc(ctx, (size_t)num_dims, sizeof(double));
+    if (!jac->scratch) {
+        gr_ctx_free(ctx, jac->point);
+        gr_ctx_free(ctx, jac->partials);
+        gr_ctx_free(ctx, jac);
+        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY,
+                     "Failed to allocate Jacobian scratch");
+        return NULL;
+    }
+    
     return jac;
 }
 
@@ -86,6 +98,10 @@ GR_API void gr_jacobian_free(gr_jacobian_t* jac)
         gr_ctx_free(ctx, jac->point);
     }
     
+    if (jac->scratch) {
+        gr_ctx_free(ctx, jac->scratch);
+    }
+    
     gr_ctx_free(ctx, jac);
 }
 
@@ -129,14 +145,16 @@ GR_API gr_error_t gr_jacobian_compute(
     /* Get the center value using interpolation */
     jac->value = gr_state_space_interpolate_price(space, point);
     
-    /* Compute partial derivatives using central differences */
-    double* bumped = (double*)gr_ctx_calloc(ctx, (size_t)n, sizeof(double));
-    if (!bumped) {
-        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY,
-                     "Failed to allocate bump buffer");
-        return GR_ERROR_OUT_OF_MEMORY;
+    /* Grid mapped by an adjoint pricer: interpolate its exact gradients */
+    if (space->gradients_valid) {
+        gr_state_space_interpolate_gradient(space, point, jac->partials);
+        jac->valid = 1;
+        return GR_SUCCESS;
     }
     
+    /* Compute partial derivatives using central differences */
+    double* bumped = jac->scratch;
+    
     for (int d = 0; d < n; d++) {
         /* Copy point */
         for (int i = 0; i < n; i++) {
@@ -160,13 +178,100 @@ GR_API gr_error_t gr_jacobian_compute(
         jac->partials[d] = (f_plus - f_minus) / (2.0 * scaled_h);
     }
     
-    gr_ctx_free(ctx, bumped);
-    
     jac->valid = 1;
     
     return GR_SUCCESS;
 }
 
+/* ============================================================================
+ * Directional Derivatives
+ * ============================================================================ */
+
+/*
+ * Step length t along v such that no coordinate moves more than
+ * bump_size * range, i.e. the same per-axis scale gr_jacobian_compute
+ * uses. Returns 0 for a zero direction.
+ */
+static double directional_step(const gr_state_space_t* space, const double* v)
+{
+    double max_rel = 0.0;
+    
+    for (int d = 0; d < space->num_dims; d++) {
+        const gr_dimension_internal_t* dim = &space->dims[d];
+        double rel = fabs(v[d]) / (dim->max_value - dim->min_value);
+        if (rel > max_rel) max_rel = rel;
+    }
+    
+    if (max_rel < 1e-300) return 0.0;
+    return space->ctx->bump_size / max_rel;
+}
+
+static double directional_central(
+    const gr_state_space_t* space,
+    const double*           point,
+    const double*           v,
+    double*                 x)
+{
+    int n = space->num_dims;
+    double t = directional_step(space, v);
+    if (t == 0.0) return 0.0;
+    
+    for (int i = 0; i < n; i++) x[i] = point[i] + t * v[i];
+    double f_plus = gr_state_space_interpolate_price(space, x);
+    
+    for (int i = 0; i < n; i++) x[i] = point[i] - t * v[i];
+    double f_minus = gr_state_space_interpolate_price(space, x);
+    
+    return (f_plus - f_minus) / (2.0 * t);
+}
+
+/**
+ * Derivative of price along `direction` (not normalised, so the result
+ * is ∇f · v). Two interpolations regardless of dimension.
+ */
+GR_API double gr_directional_derivative(
+    const gr_state_space_t* space,
+    const double*           point,
+    const double*           direction)
+{
+    if (!space || !point || !direction) return 0.0;
+    if (!space->prices_valid) return 0.0;
+    
+    double x[GR_MAX_DIMENSIONS];
+    return directional_central(space, point, direction, x);
+}
+
+/**
+ * Batched directional derivatives (Jacobian-vector products).
+ * directions is row-major [num_directions x num_dims]; out receives
+ * one derivative per direction. 2 * num_directions interpolations.
+ */
+GR_API gr_error_t gr_directional_derivatives(
+    const gr_state_space_t* space,
+    const double*           point,
+    const double*           directions,
+    int                     num_directions,
+    double*                 out)
+{
+    if (!space || !point || !directions || !out) return GR_ERROR_NULL_POINTER;
+    if (num_directions < 0) return GR_ERROR_INVALID_ARGUMENT;
+    
+    if (!space->prices_valid) {
+        gr_set_error(space->ctx, GR_ERROR_NOT_INITIALIZED,
+                     "State space prices not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+    
+    int n = space->num_dims;
+    double x[GR_MAX_DIMENSIONS];
+    
+    for (int k = 0; k < num_directions; k++) {
+        out[k] = directional_central(space, point, &directions[(size_t)k * (size_t)n], x);
+    }
+    
+    return GR_SUCCESS;
+}
+
 /* ============================================================================
  * Jacobian Accessors
  * ============================================================================ */
@@ -190,13 +295,47 @@ GR_API double gr_jacobian_norm(const gr_jacobian_t* jac)
  * Additional Jacobian Analysis Functions
  * ============================================================================ */
 
+/*
+ * Parallel stencil for slow direct pricers. Task 0 is the centre, task
+ * 2d+1 is x + h e_d and task 2d+2 is x - h e_d. Each task bumps its own
+ * stack copy of the point, so the shared input is never mutated.
+ */
+typedef struct direct_stencil_job {
+    gr_pricing_fn fn;
+    void*         user_data;
+    const double* point;
+    int           n;
+    double        h;
+    double*       values;
+} direct_stencil_job_t;
+
+static void direct_stencil_task(size_t index, int worker, void* arg)
+{
+    direct_stencil_job_t* job = (direct_stencil_job_t*)arg;
+    GR_UNUSED(worker);
+    
+    double x[GR_MAX_DIMENSIONS];
+    for (int i = 0; i < job->n; i++) {
+        x[i] = job->point[i];
+    }
+    
+    if (index > 0) {
+        int d = (int)((index - 1) / 2);
+        x[d] += (index % 2 == 1) ? job->h : -job->h;
+    }
+    
+    job->values[index] = job->fn(x, job->n, job->user_data);
+}
+
 /**
  * Compute Jacobian at a point using a pricing function directly
  * (without requiring a pre-computed state space grid).
  * 
- * This is more flexible but slower for repeated evaluations.
+ * This is more flexible but slower for repeated evaluations. When the
+ * context marks pricers re-entrant and has more than one thread, the
+ * 2n + 1 evaluations run concurrently.
  */
-gr_error_t gr_jacobian_compute_direct(
+GR_API gr_error_t gr_jacobian_compute_direct(
     gr_jacobian_t* jac,
     gr_pricing_fn  fn,
     void*          user_data,
@@ -216,16 +355,33 @@ gr_error_t gr_jacobian_compute_direct(
         jac->point[i] = point[i];
     }
     
+    /* Registered adjoint: value and full gradient in one call */
+    gr_adjoint_pricing_fn adjoint = gr_context_find_adjoint(ctx, fn);
+    if (adjoint) {
+        jac->value = adjoint(point, n, user_data, jac->partials);
+        jac->valid = 1;
+        return GR_SUCCESS;
+    }
+    
+    if (ctx->pricer_reentrant && ctx->num_threads > 1) {
+        double values[2 * GR_MAX_DIMENSIONS + 1];
+        direct_stencil_job_t job = { fn, user_data, point, n, h, values };
+        
+        gr_parallel_for(ctx, (size_t)(2 * n + 1), direct_stencil_task, &job);
+        
+        jac->value = values[0];
+        for (int d = 0; d < n; d++) {
+            jac->partials[d] = (values[2 * d + 1] - values[2 * d + 2]) / (2.0 * h);
+        }
+        
+        jac->valid = 1;
+        return GR_SUCCESS;
+    }
+    
     /* Evaluate at center */
     jac->value = fn(point, n, user_data);
     
-    /* Allocate working buffer */
-    double* bumped = (double*)gr_ctx_calloc(ctx, (size_t)n, sizeof(double));
-    if (!bumped) {
-        gr_set_error(ctx, GR_ERROR_OUT_OF_MEMORY,
-                     "Failed to allocate bump buffer");
-        return GR_ERROR_OUT_OF_MEMORY;
-    }
+    double* bumped = jac->scratch;
     
     /* Compute each partial derivative */
     for (int d = 0; d < n; d++) {
@@ -238,7 +394,179 @@ gr_error_t gr_jacobian_compute_direct(
         jac->partials[d] = gr_partial_central(fn, user_data, bumped, n, d, h);
     }
     
-    gr_ctx_free(ctx, bumped);
+    jac->valid = 1;
+    
+    return GR_SUCCESS;
+}
+
+/**
+ * One partial derivative by Ridders' method: central differences at steps
+ * h0, h0/r, h0/r², ... extrapolated to h → 0 in a Neville tableau. The
+ * error estimate is the disagreement between neighbouring tableau entries.
+ * Stops early on tolerance or when higher orders start to diverge.
+ */
+static double richardson_partial(
+    gr_pricing_fn                    fn,
+    void*                            user_data,
+    double*                          x,
+    int                              n,
+    int                              dim,
+    double                           h0,
+    const gr_adaptive_diff_config_t* cfg,
+    int                              max_levels,
+    double*                          out_error,
+    int*                             out_evals)
+{
+    double a[GR_RICHARDSON_MAX_LEVELS][GR_RICHARDSON_MAX_LEVELS];
+    double ratio2 = cfg->step_ratio * cfg->step_ratio;
+    double hh = h0;
+    
+    a[0][0] = gr_partial_central(fn, user_data, x, n, dim, hh);
+    *out_evals = 2;
+    
+    double best = a[0][0];
+    double err = HUGE_VAL;
+    
+    for (int i = 1; i < max_levels; i++) {
+        hh /= cfg->step_ratio;
+        a[0][i] = gr_partial_central(fn, user_data, x, n, dim, hh);
+        *out_evals += 2;
+        
+        double fac = ratio2;
+        for (int j = 1; j <= i; j++) {
+            a[j][i] = (a[j - 1][i] * fac - a[j - 1][i - 1]) / (fac - 1.0);
+            fac *= ratio2;
+            
+            double errt = GR_MAX(fabs(a[j][i] - a[j - 1][i]),
+                                 fabs(a[j][i] - a[j - 1][i - 1]));
+            if (errt <= err) {
+                err = errt;
+                best = a[j][i];
+            }
+        }
+        
+        if (fabs(a[i][i] - a[i - 1][i - 1]) >= GR_RICHARDSON_SAFE * err) break;
+        if (err <= cfg->tolerance) break;
+    }
+    
+    *out_error = err;
+    return best;
+}
+
+/**
+ * Adaptive-step Jacobian on a pricer with a shared evaluation budget.
+ * 
+ * Unused budget from well-behaved dimensions rolls over to the ones
+ * still to be computed. The budget must cover at least the centre plus
+ * one central difference per dimension (2n + 1 calls).
+ */
+GR_API gr_error_t gr_jacobian_compute_adaptive(
+    gr_jacobian_t*                   jac,
+    gr_pricing_fn                    fn,
+    void*                            user_data,
+    const double*                    point,
+    const gr_adaptive_diff_config_t* config,
+    double*                          out_errors,
+    int*                             out_evaluations)
+{
+    if (!jac) return GR_ERROR_NULL_POINTER;
+    if (!fn) return GR_ERROR_NULL_POINTER;
+    if (!point) return GR_ERROR_NULL_POINTER;
+    
+    gr_context_t* ctx = jac->ctx;
+    int n = jac->num_dims;
+    
+    gr_adaptive_diff_config_t cfg = GR_ADAPTIVE_DIFF_CONFIG_DEFAULT;
+    if (config) cfg = *config;
+    
+    if (cfg.initial_step <= 0.0 || cfg.step_ratio <= 1.0 ||
+        cfg.max_levels < 1 || cfg.max_levels > GR_RICHARDSON_MAX_LEVELS) {
+        gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT,
+                     "Invalid adaptive differentiation config");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+    
+    if (cfg.max_evaluations > 0 && cfg.max_evaluations < 2 * n + 1) {
+        gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT,
+                     "Evaluation budget below 2n+1");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+    
+    double x[GR_MAX_DIMENSIONS];
+    for (int i = 0; i < n; i++) {
+        jac->point[i] = point[i];
+        x[i] = point[i];
+    }
+    
+    jac->value = fn(point, n, user_data);
+    int evals = 1;
+    
+    for (int d = 0; d < n; d++) {
+        int levels = cfg.max_levels;
+        
+        if (cfg.max_evaluations > 0) {
+            int share = (cfg.max_evaluations - evals) / (n - d);
+            levels = GR_CLAMP(share / 2, 1, cfg.max_levels);
+        }
+        
+        double h0 = cfg.initial_step * GR_MAX(fabs(point[d]), 1.0);
+        double err = 0.0;
+        int used = 0;
+        
+        jac->partials[d] = richardson_partial(
+            fn, user_data, x, n, d, h0, &cfg, levels, &err, &used);
+        
+        evals += used;
+        if (out_errors) out_errors[d] = err;
+    }
+    
+    if (out_evaluations) *out_evaluations = evals;
+    
+    jac->valid = 1;
+    
+    return GR_SUCCESS;
+}
+
+/**
+ * Compute the Jacobian exactly from a hyper-dual pricer.
+ * 
+ * Each pass seeds ε1 = ε2 along one axis, so f(x).e1 is the partial
+ * with no truncation error and no bump to tune. n pricer calls total,
+ * versus 2n + 1 for central differences.
+ */
+GR_API gr_error_t gr_jacobian_compute_hyperdual(
+    gr_jacobian_t*          jac,
+    gr_hyperdual_pricing_fn fn,
+    void*                   user_data,
+    const double*           point)
+{
+    if (!jac) return GR_ERROR_NULL_POINTER;
+    if (!fn) return GR_ERROR_NULL_POINTER;
+    if (!point) return GR_ERROR_NULL_POINTER;
+    
+    int n = jac->num_dims;
+    gr_hyperdual_t x[GR_MAX_DIMENSIONS];
+    
+    for (int i = 0; i < n; i++) {
+        jac->point[i] = point[i];
+        x[i].re = point[i];
+        x[i].e1 = 0.0;
+        x[i].e2 = 0.0;
+        x[i].e12 = 0.0;
+    }
+    
+    for (int d = 0; d < n; d++) {
+        x[d].e1 = 1.0;
+        x[d].e2 = 1.0;
+        
+        gr_hyperdual_t f = fn(x, n, user_data);
+        
+        x[d].e1 = 0.0;
+        x[d].e2 = 0.0;
+        
+        if (d == 0) jac->value = f.re;
+        jac->partials[d] = f.e1;
+    }
     
     jac->valid = 1;
     
@@ -0,0 +1,318 @@
+/**
+ * lanczos.c - Matrix-free extreme curvature via Lanczos
+ *
+ * Fragility only reads the extreme eigenvalues of the Hessian, yet
+ * gr_hessian_compute materialises all n(n+1)/2 entries through mixed
+ * stencils. Here the Hessian is only ever applied to a vector:
+ *
+ *   H v ≈ (∇f(x + εv) - ∇f(x - εv)) / 2ε
+ *
+ * with ∇f the grid-step central gradient (2n interpolations), so each
+ * product costs 4n interpolations. A Lanczos iteration with full
+ * reorthogonalisation builds a small tridiagonal T whose extreme Ritz
+ * pairs converge first; it stops as soon as the wanted k top and k
+ * bottom pairs have small residuals, so the work scales with k·n rather
+ * than n².
+ */
+
+#include "georisk.h"
+#include "internal/core.h"
+#include "internal/hessian.h"
+#include "internal/state_space.h"
+#include <string.h>
+#include <math.h>
+
+#define GR_LANCZOS_TOL 1e-8
+
+/* ============================================================================
+ * Hessian-Vector Product on the Grid
+ * ============================================================================ */
+
+static void grid_gradient(
+    const gr_state_space_t* space,
+    double*                 x,
+    const double*           hstep,
+    double*                 out)
+{
+    int n = space->num_dims;
+    for (int i = 0; i < n; i++) {
+        double orig = x[i];
+        x[i] = orig + hstep[i];
+        double f_plus = gr_state_space_interpolate_price(space, x);
+        x[i] = orig - hstep[i];
+        double f_minus = gr_state_space_interpolate_price(space, x);
+        x[i] = orig;
+        out[i] = (f_plus - f_minus) / (2.0 * hstep[i]);
+    }
+}
+
+/* out = H v for unit v, step eps along v */
+static void grid_hessian_vector(
+    const gr_state_space_t* space,
+    const double*           point,
+    const double*           hstep,
+    double                  eps,
+    const double*           v,
+    double*                 out)
+{
+    int n = space->num_dims;
+    double x[GR_MAX_DIMENSIONS] = {0};
+    double g_minus[GR_MAX_DIMENSIONS];
+
+    for (int i = 0; i < n; i++) x[i] = point[i] + eps * v[i];
+    grid_gradient(space, x, hstep, out);
+
+    for (int i = 0; i < n; i++) x[i] = point[i] - eps * v[i];
+    grid_gradient(space, x, hstep, g_minus);
+
+    for (int i = 0; i < n; i++) {
+        out[i] = (out[i] - g_minus[i]) / (2.0 * eps);
+    }
+}
+
+/* ============================================================================
+ * Lanczos Iteration
+ * ============================================================================ */
+
+/* Eigen-decompose the m x m tridiagonal; Ritz values ascending in theta */
+static gr_error_t tridiagonal_ritz(
+    const double* alpha,
+    const double* beta,
+    int           m,
+    double*       theta,
+    double*       Y)
+{
+    double T[GR_MAX_DIMENSIONS * GR_MAX_DIMENSIONS];
+    double vals[GR_MAX_DIMENSIONS];
+    double V[GR_MAX_DIMENSIONS * GR_MAX_DIMENSIONS];
+
+    memset(T, 0, (size_t)(m * m) * sizeof(double));
+    for (int i = 0; i < m; i++) {
+        T[i * m + i] = alpha[i];
+        if (i + 1 < m) {
+            T[i * m + i + 1] = beta[i];
+            T[(i + 1) * m + i] = beta[i];
+        }
+    }
+
+    gr_error_t err = gr_eigen_symmetric(T, m, vals, V);
+    if (err != GR_SUCCESS) return err;
+
+    /* gr_eigen_symmetric orders by magnitude; re-sort ascending by value */
+    int order[GR_MAX_DIMENSIONS];
+    for (int i = 0; i < m; i++) order[i] = i;
+    for (int i = 1; i < m; i++) {
+        int key = order[i];
+        int j = i - 1;
+        while (j >= 0 && vals[order[j]] > vals[key]) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = key;
+    }
+
+    for (int j = 0; j < m; j++) {
+        theta[j] = vals[order[j]];
+        for (int r = 0; r < m; r++) {
+            Y[r * m + j] = V[r * m + order[j]];
+        }
+    }
+
+    return GR_SUCCESS;
+}
+
+/*
+ * Unit vector orthogonal to the m columns of Q after a breakdown. Takes
+ * the coordinate axis with the largest component outside span(Q); some
+ * axis keeps at least (n - m) / n of its squared length, so m < n always
+ * yields a well-conditioned direction.
+ */
+static void lanczos_restart_vector(const double* Q, int m, int n, double* out)
+{
+    double best = -1.0;
+
+    for (int e = 0; e < n; e++) {
+        double v[GR_MAX_DIMENSIONS];
+        memset(v, 0, (size_t)n * sizeof(double));
+        v[e] = 1.0;
+
+        for (int pass = 0; pass < 2; pass++) {
+            for (int j = 0; j < m; j++) {
+                const double* qj = &Q[j * n];
+                double dot = 0.0;
+                for (int i = 0; i < n; i++) dot += qj[i] * v[i];
+                for (int i = 0; i < n; i++) v[i] -= dot * qj[i];
+            }
+        }
+
+        double norm = 0.0;
+        for (int i = 0; i < n; i++) norm += v[i] * v[i];
+        if (norm > best) {
+            best = norm;
+            memcpy(out, v, (size_t)n * sizeof(double));
+        }
+    }
+
+    best = sqrt(best);
+    for (int i = 0; i < n; i++) out[i] /= best;
+}
+
+GR_API gr_error_t gr_hessian_lanczos(
+    const gr_state_space_t* space,
+    const double*           point,
+    int                     k,
+    double*                 top_values,
+    double*                 top_vectors,
+    double*                 bottom_values,
+    double*                 bottom_vectors,
+    double*                 out_condition,
+    int*                    out_products)
+{
+    if (!space || !point || !top_values || !bottom_values) {
+        return GR_ERROR_NULL_POINTER;
+    }
+
+    gr_context_t* ctx = space->ctx;
+    int n = space->num_dims;
+
+    if (!space->prices_valid) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED,
+                     "State space prices not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+
+    if (n < 1 || k < 1 || k > n) {
+        gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT,
+                     "Lanczos needs 1 <= k <= number of dimensions");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+
+    double hstep[GR_MAX_DIMENSIONS];
+    double eps = 0.0;
+    for (int i = 0; i < n; i++) {
+        hstep[i] = gr_state_space_grid_step(space, i);
+        if (i == 0 || hstep[i] < eps) eps = hstep[i];
+    }
+
+    /* Lanczos basis Q (columns), tridiagonal alpha/beta, Ritz workspace */
+    double Q[GR_MAX_DIMENSIONS * (GR_MAX_DIMENSIONS + 1)];
+    double alpha[GR_MAX_DIMENSIONS];
+    double beta[GR_MAX_DIMENSIONS];
+    double theta[GR_MAX_DIMENSIONS];
+    double Y[GR_MAX_DIMENSIONS * GR_MAX_DIMENSIONS];
+    double w[GR_MAX_DIMENSIONS];
+
+    /* Deterministic start vector with no exact zero components */
+    double norm = 0.0;
+    for (int i = 0; i < n; i++) {
+        Q[i] = 1.0 + 0.37 * (double)((i * 7 + 3) % 11) / 11.0;
+        norm += Q[i] * Q[i];
+    }
+    norm = sqrt(norm);
+    for (int i = 0; i < n; i++) Q[i] /= norm;
+
+    int m = 0;
+    int products = 0;
+    int want = (2 * k < n) ? 2 * k : n;
+
+    while (m < n) {
+        const double* q = &Q[m * n];
+        grid_hessian_vector(space, point, hstep, eps, q, w);
+        products++;
+
+        double a = 0.0;
+        for (int i = 0; i < n; i++) a += q[i] * w[i];
+        alpha[m] = a;
+
+        /* Full reorthogonalisation against every previous basis vector */
+        for (int pass = 0; pass < 2; pass++) {
+            for (int j = 0; j <= m; j++) {
+                const double* qj = &Q[j * n];
+                double dot = 0.0;
+                for (int i = 0; i < n; i++) dot += qj[i] * w[i];
+                for (int i = 0; i < n; i++) w[i] -= dot * qj[i];
+            }
+        }
+
+        double b = 0.0;
+        for (int i = 0; i < n; i++) b += w[i] * w[i];
+        b = sqrt(b);
+        beta[m] = b;
+        m++;
+
+        gr_error_t err = tridiagonal_ritz(alpha, beta, m, theta, Y);
+        if (err != GR_SUCCESS) {
+            gr_set_error(ctx, err, "Lanczos tridiagonal eigen-solve failed");
+            return err;
+        }
+
+        double scale = fmax(fabs(theta[0]), fabs(theta[m - 1]));
+        double tol = GR_LANCZOS_TOL * (scale > 1.0 ? scale : 1.0);
+
+        /*
+         * Invariant subspace reached: the Ritz pairs found so far are exact,
+         * but a repeated or start-orthogonal eigenvalue may still be missing.
+         * Restart from a fresh direction orthogonal to Q until the subspace
+         * is as large as the converged case would need; the zero beta keeps
+         * the tridiagonal blocks decoupled.
+         */
+        if (b <= tol) {
+            if (m >= want) break;
+            beta[m - 1] = 0.0;
+            lanczos_restart_vector(Q, m, n, &Q[m * n]);
+            continue;
+        }
+
+        /* Residual of Ritz pair j is |beta_m * Y[m-1, j]| */
+        if (m >= want) {
+            int converged = 1;
+            for (int j = 0; j < k && j < m; j++) {
+                if (fabs(b * Y[(m - 1) * m + j]) > tol ||
+                    fabs(b * Y[(m - 1) * m + (m - 1 - j)]) > tol) {
+                    converged = 0;
+                    break;
+                }
+            }
+            if (converged) break;
+        }
+
+        if (m < n) {
+            for (int i = 0; i < n; i++) Q[m * n + i] = w[i] / b;
+        }
+    }
+
+    /* Every exit leaves m >= want >= k Ritz pairs */
+    for (int j = 0; j < k; j++) {
+        int top = m - 1 - j;
+        int bottom = j;
+
+        top_values[j] = theta[top];
+        bottom_values[j] = theta[bottom];
+
+        for (int i = 0; i < n; i++) {
+            double vt = 0.0;
+            double vb = 0.0;
+            for (int r = 0; r < m; r++) {
+                vt += Q[r * n + i] * Y[r * m + top];
+                vb += Q[r * n + i] * Y[r * m + bottom];
+            }
+            if (top_vectors) top_vectors[j * n + i] = vt;
+            if (bottom_vectors) bottom_vectors[j * n + i] = vb;
+        }
+    }
+
+    if (out_condition) {
+        double max_abs = 0.0;
+        double min_abs = 1e300;
+        for (int j = 0; j < m; j++) {
+            double abs_val = fabs(theta[j]);
+            if (abs_val > max_abs) max_abs = abs_val;
+            if (abs_val > 1e-15 && abs_val < min_abs) min_abs = abs_val;
+        }
+        *out_condition = (min_abs < 1e-15 || min_abs == 1e300) ? 1e15 : max_abs / min_abs;
+    }
+
+    if (out_products) *out_products = products;
+
+    return GR_SUCCESS;
+}
@@ -0,0 +1,180 @@
+/**
+ * local_geometry.c - Combined value / gradient / curvature evaluation
+ *
+ * gr_jacobian_compute and gr_hessian_compute each walk their own stencil
+ * around the evaluation point. When both are needed at the same point
+ * (the fragility scan does this at every node) the centre and the axial
+ * neighbours get interpolated twice.
+ *
+ * This module evaluates one stencil with grid-spacing steps h_i:
+ *
+ *   centre         f(x)                        1 evaluation
+ *   axial          f(x ± h_i e_i)              2n evaluations
+ *   diagonal pairs f(x ± h_i e_i ± h_j e_j)    4 per pair
+ *
+ * and derives everything from it:
+ *
+ *   ∂f/∂x_i      = (f+ - f-) / 2h_i
+ *   ∂²f/∂x_i²    = (f+ - 2f + f-) / h_i²
+ *   ∂²f/∂x_i∂x_j = (f++ - f+- - f-+ + f--) / 4h_i h_j
+ *
+ * gr_local_geometry_compute_analytic skips the stencil altogether and
+ * differentiates the multilinear interpolant in closed form.
+ */
+
+#include "georisk.h"
+#include "internal/core.h"
+#include "internal/allocator.h"
+#include "internal/jacobian.h"
+#include "internal/hessian.h"
+#include "internal/state_space.h"
+#include <string.h>
+#include <math.h>
+
+/* ============================================================================
+ * Combined Stencil Evaluation
+ * ============================================================================ */
+
+GR_API gr_error_t gr_local_geometry_compute(
+    gr_jacobian_t*          jac,
+    gr_hessian_t*           hess,
+    const gr_state_space_t* space,
+    const double*           point)
+{
+    if (!jac || !hess || !space || !point) {
+        return GR_ERROR_NULL_POINTER;
+    }
+
+    gr_context_t* ctx = jac->ctx;
+    int n = space->num_dims;
+
+    if (jac->num_dims != n || hess->num_dims != n) {
+        gr_set_error(ctx, GR_ERROR_DIMENSION_MISMATCH,
+                     "Jacobian/Hessian dimensions don't match state space");
+        return GR_ERROR_DIMENSION_MISMATCH;
+    }
+
+    if (!space->prices_valid) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED,
+                     "State space prices not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+
+    double x[GR_MAX_DIMENSIONS] = {0};
+    double hstep[GR_MAX_DIMENSIONS];
+
+    for (int i = 0; i < n; i++) {
+        x[i] = point[i];
+        jac->point[i] = point[i];
+        hess->point[i] = point[i];
+        hstep[i] = gr_state_space_grid_step(space, i);
+    }
+
+    hess->eigen_valid = 0;
+
+    /* Centre */
+    double f_center = gr_state_space_interpolate_price(space, x);
+    jac->value = f_center;
+
+    /* Axial points: gradient and Hessian diagonal */
+    for (int i = 0; i < n; i++) {
+        double orig = x[i];
+        double hi = hstep[i];
+
+        x[i] = orig + hi;
+        double f_plus = gr_state_space_interpolate_price(space, x);
+
+        x[i] = orig - hi;
+        double f_minus = gr_state_space_interpolate_price(space, x);
+
+        x[i] = orig;
+
+        jac->partials[i] = (f_plus - f_minus) / (2.0 * hi);
+        hess->data[i * n + i] = (f_plus - 2.0 * f_center + f_minus) / (hi * hi);
+    }
+
+    /* Diagonal corners: mixed partials */
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            double orig_i = x[i];
+            double orig_j = x[j];
+
+            double hi = hstep[i];
+            double hj = hstep[j];
+
+            x[i] = orig_i + hi; x[j] = orig_j + hj;
+            double f_pp = gr_state_space_interpolate_price(space, x);
+
+            x[i] = orig_i + hi; x[j] = orig_j - hj;
+            double f_pm = gr_state_space_interpolate_price(space, x);
+
+            x[i] = orig_i - hi; x[j] = orig_j + hj;
+            double f_mp = gr_state_space_interpolate_price(space, x);
+
+            x[i] = orig_i - hi; x[j] = orig_j - hj;
+            double f_mm = gr_state_space_interpolate_price(space, x);
+
+            x[i] = orig_i;
+            x[j] = orig_j;
+
+            double d2f = (f_pp - f_pm - f_mp + f_mm) / (4.0 * hi * hj);
+
+            hess->data[i * n + j] = d2f;
+            hess->data[j * n + i] = d2f;
+        }
+    }
+
+    jac->valid = 1;
+    hess->valid = 1;
+
+    return GR_SUCCESS;
+}
+
+/* ============================================================================
+ * Closed-Form Interpolant Derivatives
+ * ============================================================================ */
+
+GR_API gr_error_t gr_local_geometry_compute_analytic(
+    gr_jacobian_t*          jac,
+    gr_hessian_t*           hess,
+    const gr_state_space_t* space,
+    const double*           point)
+{
+    if ((!jac && !hess) || !space || !point) {
+        return GR_ERROR_NULL_POINTER;
+    }
+
+    gr_context_t* ctx = jac ? jac->ctx : hess->ctx;
+    int n = space->num_dims;
+
+    if ((jac && jac->num_dims != n) || (hess && hess->num_dims != n)) {
+        gr_set_error(ctx, GR_ERROR_DIMENSION_MISMATCH,
+                     "Jacobian/Hessian dimensions don't match state space");
+        return GR_ERROR_DIMENSION_MISMATCH;
+    }
+
+    if (!space->prices_valid) {
+        gr_set_error(ctx, GR_ERROR_NOT_INITIALIZED,
+                     "State space prices not computed");
+        return GR_ERROR_NOT_INITIALIZED;
+    }
+
+    double value = 0.0;
+    gr_state_space_interpolant_derivatives(space, point, &value,
+                                           jac ? jac->partials : NULL,
+                                           hess ? hess->data : NULL);
+
+    if (jac) {
+        for (int i = 0; i < n; i++) jac->point[i] = point[i];
+        jac->value = value;
+        jac->valid = 1;
+    }
+
+    if (hess) {
+        for (int i = 0; i < n; i++) hess->point[i] = point[i];
+        hess->eigen_valid = 0;
+        hess->valid = 1;
+    }
+
+    return GR_SUCCESS;
+}
@@ -33,6 +33,8 @@ GR_API gr_context_t* gr_context_new(void)
     /* Set defaults */
     ctx->bump_size = GR_DEFAULT_BUMP;
     ctx->num_threads = 1;
+    ctx->pricer_reentrant = 0;
+    ctx->num_adjoints = 0;
     ctx->last_error = GR_SUCCESS;
     ctx->error_msg[0] = '\0';
     
@@ -127,6 +129,53 @@ GR_API void gr_context_set_num_threads(gr_context_t* ctx, int threads)
     }
 }
 
+GR_API void gr_context_set_pricer_reentrant(gr_context_t* ctx, int reentrant)
+{
+    if (!ctx) return;
+    
+    ctx->pricer_reentrant = reentrant ? 1 : 0;
+}
+
+/* ============================================================================
+ * Adjoint Pricer Registry
+ * ============================================================================ */
+
+GR_API gr_error_t gr_context_register_adjoint(
+    gr_context_t*         ctx,
+    gr_pricing_fn         fn,
+    gr_adjoint_pricing_fn adjoint)
+{
+    if (!ctx) return GR_ERROR_NULL_POINTER;
+    if (!fn) return GR_ERROR_NULL_POINTER;
+    
+    for (int i = 0; i < ctx->num_adjoints; i++) {
+        if (ctx->adjoints[i].fn != fn) continue;
+        
+        if (adjoint) {
+            ctx->adjoints[i].adjoint = adjoint;
+        } else {
+            /* Unregister: move the last entry into this slot */
+            ctx->num_adjoints--;
+            ctx->adjoints[i] = ctx->adjoints[ctx->num_adjoints];
+        }
+        return GR_SUCCESS;
+    }
+    
+    if (!adjoint) return GR_SUCCESS;
+    
+    if (ctx->num_adjoints >= GR_MAX_ADJOINTS) {
+        gr_set_error(ctx, GR_ERROR_INVALID_ARGUMENT,
+                     "Maximum adjoint pricers exceeded");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+    
+    ctx->adjoints[ctx->num_adjoints].fn = fn;
+    ctx->adjoints[ctx->num_adjoints].adjoint = adjoint;
+    ctx->num_adjoints++;
+    
+    return GR_SUCCESS;
+}
+
 /* ============================================================================
  * Error Handling
  * ============================================================================ */
@@ -0,0 +1,84 @@
+/**
+ * parallel.c - Fork/join parallel-for over pthreads
+ */
+
+#include "georisk.h"
+#include "internal/core.h"
+#include "internal/parallel.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* ============================================================================
+ * Worker State
+ * ============================================================================ */
+
+typedef struct gr_parallel_job {
+    gr_parallel_task_fn fn;
+    void*               arg;
+    size_t              count;
+    atomic_size_t       next;
+} gr_parallel_job_t;
+
+typedef struct gr_parallel_worker {
+    gr_parallel_job_t* job;
+    int                id;
+} gr_parallel_worker_t;
+
+static void gr_parallel_drain(gr_parallel_job_t* job, int worker)
+{
+    for (;;) {
+        size_t i = atomic_fetch_add(&job->next, 1);
+        if (i >= job->count) break;
+        job->fn(i, worker, job->arg);
+    }
+}
+
+static void* gr_parallel_thread_main(void* arg)
+{
+    gr_parallel_worker_t* w = (gr_parallel_worker_t*)arg;
+    gr_parallel_drain(w->job, w->id);
+    return NULL;
+}
+
+/* ============================================================================
+ * Parallel For
+ * ============================================================================ */
+
+void gr_parallel_for(
+    const gr_context_t* ctx,
+    size_t              count,
+    gr_parallel_task_fn fn,
+    void*               arg)
+{
+    if (!fn || count == 0) return;
+
+    int workers = gr_parallel_num_workers(ctx, count);
+
+    gr_parallel_job_t job;
+    job.fn = fn;
+    job.arg = arg;
+    job.count = count;
+    atomic_init(&job.next, 0);
+
+    if (workers == 1) {
+        gr_parallel_drain(&job, 0);
+        return;
+    }
+
+    pthread_t threads[GR_MAX_THREADS];
+    gr_parallel_worker_t state[GR_MAX_THREADS];
+    int started[GR_MAX_THREADS];
+
+    for (int t = 1; t < workers; t++) {
+        state[t].job = &job;
+        state[t].id = t;
+        started[t] = pthread_create(&threads[t], NULL,
+                                    gr_parallel_thread_main, &state[t]) == 0;
+    }
+
+    gr_parallel_drain(&job, 0);
+
+    for (int t = 1; t < workers; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+    }
+}
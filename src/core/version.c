@@ -57,6 +57,7 @@ GR_API const char* gr_error_string(gr_error_t err)
         case GR_ERROR_PRICING_ENGINE_FAILED: return "Pricing engine failed";
         case GR_ERROR_CONSTRAINT_VIOLATION:  return "Constraint violation";
         case GR_ERROR_NOT_INITIALIZED:       return "Not initialized";
+        case GR_ERROR_IO:                    return "I/O error";
         default:                             return "Unknown error";
     }
 }
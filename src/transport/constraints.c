@@ -149,6 +149,50 @@ GR_API gr_error_t gr_constraint_add(
     return GR_SUCCESS;
 }
 
+GR_API gr_error_t gr_constraint_bind_dimension(
+    gr_constraint_surface_t* surface,
+    int                      index,
+    int                      dimension)
+{
+    if (!surface) return GR_ERROR_NULL_POINTER;
+    
+    if (index < 0 || index >= surface->num_constraints || dimension < 0 ||
+        dimension >= GR_MAX_DIMENSIONS) {
+        gr_set_error(surface->ctx, GR_ERROR_INVALID_ARGUMENT,
+                     "Invalid constraint index or dimension");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+    
+    gr_constraint_t* c = &surface->constraints[index];
+    c->dimension = dimension;
+    c->eval_fn = NULL;
+    c->user_data = NULL;
+    
+    return GR_SUCCESS;
+}
+
+GR_API gr_error_t gr_constraint_bind_function(
+    gr_constraint_surface_t* surface,
+    int                      index,
+    gr_pricing_fn            fn,
+    void*                    user_data)
+{
+    if (!surface || !fn) return GR_ERROR_NULL_POINTER;
+    
+    if (index < 0 || index >= surface->num_constraints) {
+        gr_set_error(surface->ctx, GR_ERROR_INVALID_ARGUMENT,
+                     "Invalid constraint index");
+        return GR_ERROR_INVALID_ARGUMENT;
+    }
+    
+    gr_constraint_t* c = &surface->constraints[index];
+    c->dimension = -1;
+    c->eval_fn = fn;
+    c->user_data = user_data;
+    
+    return GR_SUCCESS;
+}
+
 /* ============================================================================
  * Advanced Constraint Configuration
  * ============================================================================ */
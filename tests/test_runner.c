@@ -4,7 +4,11 @@
 
 #include "unity.h"
 #include "georisk.h"
+#include "georisk_dual.h"
+#include "georisk_columnar.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 /* ============================================================================
@@ -507,6 +511,1534 @@ void test_integration_hessian_on_quadratic(void)
     gr_state_space_free(space);
 }
 
+/* Build a 21x21 grid over [-5,5]^2 with simple_quadratic mapped onto it */
+static gr_state_space_t* make_quadratic_space(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    
+    gr_dimension_t dim_x = {
+        .type = GR_DIM_CUSTOM,
+        .name = "x",
+        .min_value = -5.0,
+        .max_value = 5.0,
+        .num_points = 21
+    };
+    
+    gr_dimension_t dim_y = {
+        .type = GR_DIM_CUSTOM,
+        .name = "y",
+        .min_value = -5.0,
+        .max_value = 5.0,
+        .num_points = 21
+    };
+    
+    gr_state_space_add_dimension(space, &dim_x);
+    gr_state_space_add_dimension(space, &dim_y);
+    gr_state_space_map_prices(space, simple_quadratic, NULL);
+    
+    return space;
+}
+
+void test_integration_local_geometry_on_quadratic(void)
+{
+    gr_state_space_t* space = make_quadratic_space();
+    
+    gr_jacobian_t* jac = gr_jacobian_new(g_ctx, 2);
+    gr_hessian_t* hess = gr_hessian_new(g_ctx, 2);
+    double point[] = {2.0, 3.0};
+    
+    gr_error_t err = gr_local_geometry_compute(jac, hess, space, point);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 4.0, gr_jacobian_get(jac, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 6.0, gr_jacobian_get(jac, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(0.2, 2.0, gr_hessian_get(hess, 0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.2, 0.0, gr_hessian_get(hess, 0, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(0.2, 2.0, gr_hessian_get(hess, 1, 1));
+    
+    /* Hessian must agree exactly with the standalone stencil */
+    gr_hessian_t* ref = gr_hessian_new(g_ctx, 2);
+    gr_hessian_compute(ref, space, point);
+    for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < 2; j++) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, gr_hessian_get(ref, i, j),
+                                      gr_hessian_get(hess, i, j));
+        }
+    }
+    
+    gr_hessian_free(ref);
+    gr_hessian_free(hess);
+    gr_jacobian_free(jac);
+    gr_state_space_free(space);
+}
+
+void test_integration_fragility_on_quadratic(void)
+{
+    gr_state_space_t* space = make_quadratic_space();
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    
+    gr_error_t err = gr_fragility_map_compute(map);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    /* Gradient grows away from the origin, so the corner is more fragile */
+    double origin[] = {0.0, 0.0};
+    double corner[] = {4.5, 4.5};
+    TEST_ASSERT_TRUE(gr_fragility_at_point(map, corner) > gr_fragility_at_point(map, origin));
+    TEST_ASSERT_GREATER_THAN(0, gr_fragility_map_get_num_fragile_regions(map));
+    
+    gr_fragility_map_free(map);
+    gr_state_space_free(space);
+}
+
+/* f(x, y) = x^2 y + exp(x), written once over hyper-dual numbers */
+static gr_hyperdual_t hyperdual_test_fn(const gr_hyperdual_t* c, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    gr_hyperdual_t x2y = gr_hd_mul(gr_hd_mul(c[0], c[0]), c[1]);
+    return gr_hd_add(x2y, gr_hd_exp(c[0]));
+}
+
+void test_hyperdual_exact_derivatives(void)
+{
+    double point[] = {0.5, 2.0};
+    double ex = exp(0.5);
+    
+    gr_jacobian_t* jac = gr_jacobian_new(g_ctx, 2);
+    gr_error_t err = gr_jacobian_compute_hyperdual(jac, hyperdual_test_fn, NULL, point);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 2.0 * 0.5 * 2.0 + ex, gr_jacobian_get(jac, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.25, gr_jacobian_get(jac, 1));
+    
+    gr_hessian_t* hess = gr_hessian_new(g_ctx, 2);
+    err = gr_hessian_compute_hyperdual(hess, hyperdual_test_fn, NULL, point);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 4.0 + ex, gr_hessian_get(hess, 0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.0, gr_hessian_get(hess, 0, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.0, gr_hessian_get(hess, 1, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.0, gr_hessian_get(hess, 1, 1));
+    
+    gr_hessian_free(hess);
+    gr_jacobian_free(jac);
+}
+
+static double smooth_test_fn(const double* c, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    return sin(c[0]) * exp(c[1]);
+}
+
+void test_jacobian_adaptive_richardson(void)
+{
+    double point[] = {1.0, 0.5};
+    double errors[2];
+    int evals = 0;
+    
+    gr_jacobian_t* jac = gr_jacobian_new(g_ctx, 2);
+    gr_error_t err = gr_jacobian_compute_adaptive(
+        jac, smooth_test_fn, NULL, point, NULL, errors, &evals);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    TEST_ASSERT_DOUBLE_WITHIN(1e-8, cos(1.0) * exp(0.5), gr_jacobian_get(jac, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-8, sin(1.0) * exp(0.5), gr_jacobian_get(jac, 1));
+    TEST_ASSERT_LESS_THAN(1e-6, errors[0]);
+    TEST_ASSERT_LESS_THAN(1e-6, errors[1]);
+    
+    /* Budget of 2n+1 degenerates to one central difference per axis */
+    gr_adaptive_diff_config_t cfg = GR_ADAPTIVE_DIFF_CONFIG_DEFAULT;
+    cfg.max_evaluations = 5;
+    err = gr_jacobian_compute_adaptive(jac, smooth_test_fn, NULL, point, &cfg, NULL, &evals);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    TEST_ASSERT_EQUAL_INT(5, evals);
+    
+    cfg.max_evaluations = 4;
+    err = gr_jacobian_compute_adaptive(jac, smooth_test_fn, NULL, point, &cfg, NULL, NULL);
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_INVALID_ARGUMENT, err);
+    
+    gr_jacobian_free(jac);
+}
+
+void test_jacobian_direct_parallel_matches_serial(void)
+{
+    double point[] = {1.0, 0.5};
+    
+    gr_jacobian_t* serial = gr_jacobian_new(g_ctx, 2);
+    gr_jacobian_compute_direct(serial, smooth_test_fn, NULL, point, 1e-4);
+    
+    gr_context_set_num_threads(g_ctx, 4);
+    gr_context_set_pricer_reentrant(g_ctx, 1);
+    
+    gr_jacobian_t* par = gr_jacobian_new(g_ctx, 2);
+    gr_error_t err = gr_jacobian_compute_direct(par, smooth_test_fn, NULL, point, 1e-4);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    for (int d = 0; d < 2; d++) {
+        TEST_ASSERT_TRUE(gr_jacobian_get(serial, d) == gr_jacobian_get(par, d));
+    }
+    
+    gr_jacobian_free(par);
+    gr_jacobian_free(serial);
+}
+
+void test_directional_derivative_on_quadratic(void)
+{
+    gr_state_space_t* space = make_quadratic_space();
+    double point[] = {2.0, 3.0};
+    
+    /* Gradient is (4, 6) */
+    double parallel[] = {1.0, 1.0};
+    TEST_ASSERT_DOUBLE_WITHIN(0.2, 10.0, gr_directional_derivative(space, point, parallel));
+    
+    double dirs[] = {
+        1.0,  0.0,
+        0.0,  1.0,
+        2.0, -1.0
+    };
+    double out[3];
+    gr_error_t err = gr_directional_derivatives(space, point, dirs, 3, out);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 4.0, out[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 6.0, out[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.2, 2.0, out[2]);
+    
+    gr_state_space_free(space);
+}
+
+static int g_plain_calls = 0;
+
+static double counted_quadratic(const double* coords, int num_dims, void* user_data)
+{
+    g_plain_calls++;
+    return simple_quadratic(coords, num_dims, user_data);
+}
+
+static double quadratic_adjoint(const double* coords, int num_dims, void* user_data,
+                                double* out_gradient)
+{
+    for (int i = 0; i < num_dims; i++) {
+        out_gradient[i] = 2.0 * coords[i];
+    }
+    return simple_quadratic(coords, num_dims, user_data);
+}
+
+void test_adjoint_pricer_gradients(void)
+{
+    gr_error_t err = gr_context_register_adjoint(g_ctx, counted_quadratic, quadratic_adjoint);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    g_plain_calls = 0;
+    
+    /* Direct path: one adjoint call, no bumped plain calls */
+    gr_jacobian_t* jac = gr_jacobian_new(g_ctx, 2);
+    double point[] = {2.25, 3.1};
+    err = gr_jacobian_compute_direct(jac, counted_quadratic, NULL, point, 0.0);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    TEST_ASSERT_EQUAL_INT(0, g_plain_calls);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 4.5, gr_jacobian_get(jac, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 6.2, gr_jacobian_get(jac, 1));
+    
+    /* Grid path: gradient grid recorded during mapping, then interpolated */
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -5.0,
+        .max_value = 5.0,
+        .num_points = 21
+    };
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, counted_quadratic, NULL);
+    TEST_ASSERT_EQUAL_INT(0, g_plain_calls);
+    
+    err = gr_jacobian_compute(jac, space, point);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 4.5, gr_jacobian_get(jac, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 6.2, gr_jacobian_get(jac, 1));
+    
+    /* Unregistered: falls back to bumping the plain pricer */
+    gr_context_register_adjoint(g_ctx, counted_quadratic, NULL);
+    gr_jacobian_compute_direct(jac, counted_quadratic, NULL, point, 0.0);
+    TEST_ASSERT_EQUAL_INT(5, g_plain_calls);
+    
+    gr_state_space_free(space);
+    gr_jacobian_free(jac);
+}
+
+/* f(x, y) = x y + x^2: bilinear cross term, quadratic along x */
+static double cross_quadratic(const double* coords, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    return coords[0] * coords[1] + coords[0] * coords[0];
+}
+
+void test_local_geometry_analytic_interpolant(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -5.0,
+        .max_value = 5.0,
+        .num_points = 21
+    };
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, cross_quadratic, NULL);
+    
+    gr_jacobian_t* jac = gr_jacobian_new(g_ctx, 2);
+    gr_hessian_t* hess = gr_hessian_new(g_ctx, 2);
+    
+    /* Inside cell [1.0, 1.5] x [-3.0, -2.5] */
+    double point[] = {1.3, -2.7};
+    gr_error_t err = gr_local_geometry_compute_analytic(jac, hess, space, point);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    /* Interpolant of x^2 is the chord across the cell: slope x_lo + x_hi */
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, -2.7 + 2.5, gr_jacobian_get(jac, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.3, gr_jacobian_get(jac, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 2.0, gr_hessian_get(hess, 0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.0, gr_hessian_get(hess, 0, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.0, gr_hessian_get(hess, 1, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.0, gr_hessian_get(hess, 1, 1));
+    
+    /* Diagonal at an interior node matches the finite-difference stencil */
+    gr_hessian_t* ref = gr_hessian_new(g_ctx, 2);
+    double node[] = {2.0, 3.0};
+    gr_hessian_compute(ref, space, node);
+    gr_local_geometry_compute_analytic(NULL, hess, space, node);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, gr_hessian_get(ref, 0, 0), gr_hessian_get(hess, 0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, gr_hessian_get(ref, 1, 1), gr_hessian_get(hess, 1, 1));
+    
+    gr_hessian_free(ref);
+    gr_hessian_free(hess);
+    gr_jacobian_free(jac);
+    gr_state_space_free(space);
+}
+
+/* f = x^2 + 2y^2 + 3z^2 + xy: constant Hessian [[2,1,0],[1,4,0],[0,0,6]] */
+static gr_hyperdual_t coupled_quadratic_hd(const gr_hyperdual_t* c, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    gr_hyperdual_t f = gr_hd_mul(c[0], c[0]);
+    f = gr_hd_add(f, gr_hd_scale(gr_hd_mul(c[1], c[1]), 2.0));
+    f = gr_hd_add(f, gr_hd_scale(gr_hd_mul(c[2], c[2]), 3.0));
+    return gr_hd_add(f, gr_hd_mul(c[0], c[1]));
+}
+
+void test_hessian_eigenvectors(void)
+{
+    gr_hessian_t* hess = gr_hessian_new(g_ctx, 3);
+    double point[] = {0.3, -1.2, 0.7};
+    gr_error_t err = gr_hessian_compute_hyperdual(hess, coupled_quadratic_hd, NULL, point);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    double values[3];
+    double vectors[9];
+    err = gr_hessian_eigenvectors(hess, values, vectors, 3);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, 6.0, values[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, 3.0 + sqrt(2.0), values[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, 3.0 - sqrt(2.0), values[2]);
+    
+    /* H v = lambda v, unit length, largest component positive */
+    for (int j = 0; j < 3; j++) {
+        const double* v = &vectors[j * 3];
+        double norm = 0.0;
+        for (int r = 0; r < 3; r++) {
+            double hv = 0.0;
+            for (int c = 0; c < 3; c++) hv += gr_hessian_get(hess, r, c) * v[c];
+            TEST_ASSERT_DOUBLE_WITHIN(1e-10, values[j] * v[r], hv);
+            norm += v[r] * v[r];
+        }
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.0, norm);
+    }
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.0, vectors[2]);
+    
+    /* Eigenvalue-only path agrees */
+    double only[3];
+    gr_hessian_eigenvalues(hess, only, 3);
+    for (int j = 0; j < 3; j++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-15, values[j], only[j]);
+    }
+    
+    gr_hessian_free(hess);
+}
+
+static double coupled_quadratic(const double* coords, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    double x = coords[0], y = coords[1], z = coords[2];
+    return x * x + 2.0 * y * y + 3.0 * z * z + x * y;
+}
+
+void test_hessian_lanczos_extremes(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -2.0,
+        .max_value = 2.0,
+        .num_points = 41
+    };
+    for (int d = 0; d < 3; d++) gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, coupled_quadratic, NULL);
+    
+    double point[] = {0.3, -0.4, 0.5};
+    double top[1], bottom[1], top_vec[3];
+    double cond = 0.0;
+    int products = 0;
+    
+    gr_error_t err = gr_hessian_lanczos(space, point, 1, top, top_vec, bottom, NULL,
+                                        &cond, &products);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 6.0, top[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 3.0 - sqrt(2.0), bottom[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.2, 6.0 / (3.0 - sqrt(2.0)), cond);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 1.0, fabs(top_vec[2]));
+    TEST_ASSERT_TRUE(products <= 3);
+    
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_INVALID_ARGUMENT,
+                          gr_hessian_lanczos(space, point, 4, top, NULL, bottom, NULL,
+                                             NULL, NULL));
+    
+    gr_state_space_free(space);
+}
+
+static double repeated_quadratic(const double* coords, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    double x = coords[0], y = coords[1], z = coords[2];
+    return 0.5 * x * x + 0.5 * y * y + 2.5 * z * z;
+}
+
+void test_hessian_lanczos_repeated_eigenvalue(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -2.0,
+        .max_value = 2.0,
+        .num_points = 41
+    };
+    for (int d = 0; d < 3; d++) gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, repeated_quadratic, NULL);
+    
+    /* H = diag(1, 1, 5): one start vector only sees the double 1 once */
+    double point[] = {0.3, -0.4, 0.5};
+    double top[2], bottom[2];
+    double cond = 0.0;
+    
+    gr_error_t err = gr_hessian_lanczos(space, point, 2, top, NULL, bottom, NULL,
+                                        &cond, NULL);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 5.0, top[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 1.0, top[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 1.0, bottom[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 1.0, bottom[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.2, 5.0, cond);
+    
+    gr_state_space_free(space);
+}
+
+void test_state_space_hessian_field(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -2.0,
+        .max_value = 2.0,
+        .num_points = 9
+    };
+    for (int d = 0; d < 3; d++) gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, coupled_quadratic, NULL);
+    
+    size_t total = gr_state_space_get_total_points(space);
+    double* packed = (double*)malloc(total * 6 * sizeof(double));
+    double* frob = (double*)malloc(total * sizeof(double));
+    double* trace = (double*)malloc(total * sizeof(double));
+    
+    gr_error_t err = gr_state_space_hessian_field(space, packed, frob, trace);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    
+    /* Interior node (1, -0.5, 0.5): exact constant Hessian */
+    size_t node = 6 * 81 + 3 * 9 + 5;
+    const double* h = &packed[node * 6];
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 2.0, h[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 1.0, h[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 0.0, h[2]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 4.0, h[3]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 0.0, h[4]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 6.0, h[5]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 12.0, trace[node]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, sqrt(4.0 + 2.0 + 16.0 + 36.0), frob[node]);
+    
+    /* Every node, edges included, matches the per-node stencil */
+    gr_hessian_t* hess = gr_hessian_new(g_ctx, 3);
+    double max_diff = 0.0;
+    for (size_t i = 0; i < total; i++) {
+        double pt[3] = {
+            -2.0 + 0.5 * (double)(i / 81),
+            -2.0 + 0.5 * (double)((i / 9) % 9),
+            -2.0 + 0.5 * (double)(i % 9)
+        };
+        gr_hessian_compute(hess, space, pt);
+        const double* hi = &packed[i * 6];
+        double ref[6] = {
+            gr_hessian_get(hess, 0, 0), gr_hessian_get(hess, 0, 1),
+            gr_hessian_get(hess, 0, 2), gr_hessian_get(hess, 1, 1),
+            gr_hessian_get(hess, 1, 2), gr_hessian_get(hess, 2, 2)
+        };
+        for (int e = 0; e < 6; e++) {
+            double diff = fabs(ref[e] - hi[e]);
+            if (diff > max_diff) max_diff = diff;
+        }
+    }
+    TEST_ASSERT_TRUE(max_diff < 1e-8);
+    
+    /* Threaded sweep is identical */
+    double* trace_mt = (double*)malloc(total * sizeof(double));
+    gr_context_set_num_threads(g_ctx, 4);
+    gr_state_space_hessian_field(space, NULL, NULL, trace_mt);
+    for (size_t i = 0; i < total; i++) {
+        TEST_ASSERT_TRUE(trace[i] == trace_mt[i]);
+    }
+    
+    free(trace_mt);
+    gr_hessian_free(hess);
+    free(trace);
+    free(frob);
+    free(packed);
+    gr_state_space_free(space);
+}
+
+static double varying_curvature(const double* coords, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    double x = coords[0], y = coords[1], z = coords[2];
+    return x * x * y + x * sin(z) + exp(y * z);
+}
+
+void test_state_space_hessian_field_blocks(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -2.0,
+        .max_value = 2.0,
+        .num_points = 21
+    };
+    for (int d = 0; d < 3; d++) gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, varying_curvature, NULL);
+    
+    /* 9261 nodes: three blocks, the last one partial */
+    size_t total = gr_state_space_get_total_points(space);
+    TEST_ASSERT_TRUE(total > 2 * 4096);
+    
+    double* packed[2];
+    double* frob[2];
+    double* trace[2];
+    for (int t = 0; t < 2; t++) {
+        packed[t] = (double*)malloc(total * 6 * sizeof(double));
+        frob[t] = (double*)malloc(total * sizeof(double));
+        trace[t] = (double*)malloc(total * sizeof(double));
+        gr_context_set_num_threads(g_ctx, t == 0 ? 1 : 4);
+        TEST_ASSERT_EQUAL_INT(GR_SUCCESS,
+                              gr_state_space_hessian_field(space, packed[t], frob[t], trace[t]));
+    }
+    
+    TEST_ASSERT_TRUE(memcmp(packed[0], packed[1], total * 6 * sizeof(double)) == 0);
+    TEST_ASSERT_TRUE(memcmp(frob[0], frob[1], total * sizeof(double)) == 0);
+    TEST_ASSERT_TRUE(memcmp(trace[0], trace[1], total * sizeof(double)) == 0);
+    
+    /* Nodes either side of each block start match the per-node stencil */
+    gr_hessian_t* hess = gr_hessian_new(g_ctx, 3);
+    size_t starts[] = {4096, 8192};
+    for (int b = 0; b < 2; b++) {
+        for (size_t i = starts[b] - 2; i < starts[b] + 2; i++) {
+            double pt[3] = {
+                -2.0 + 0.2 * (double)(i / 441),
+                -2.0 + 0.2 * (double)((i / 21) % 21),
+                -2.0 + 0.2 * (double)(i % 21)
+            };
+            gr_hessian_compute(hess, space, pt);
+            const double* hi = &packed[1][i * 6];
+            TEST_ASSERT_DOUBLE_WITHIN(1e-8, gr_hessian_get(hess, 0, 0), hi[0]);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-8, gr_hessian_get(hess, 0, 1), hi[1]);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-8, gr_hessian_get(hess, 0, 2), hi[2]);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-8, gr_hessian_get(hess, 1, 1), hi[3]);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-8, gr_hessian_get(hess, 1, 2), hi[4]);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-8, gr_hessian_get(hess, 2, 2), hi[5]);
+        }
+    }
+    
+    gr_hessian_free(hess);
+    for (int t = 0; t < 2; t++) {
+        free(trace[t]);
+        free(frob[t]);
+        free(packed[t]);
+    }
+    gr_state_space_free(space);
+}
+
+/* f = x^2 y + x sin(z) + exp(y z): Hessian varies smoothly with position */
+static gr_hyperdual_t varying_curvature_hd(const gr_hyperdual_t* c, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    gr_hyperdual_t f = gr_hd_mul(gr_hd_mul(c[0], c[0]), c[1]);
+    f = gr_hd_add(f, gr_hd_mul(c[0], gr_hd_sin(c[2])));
+    return gr_hd_add(f, gr_hd_exp(gr_hd_mul(c[1], c[2])));
+}
+
+void test_hessian_warm_start_scan(void)
+{
+    gr_hessian_t* cold = gr_hessian_new(g_ctx, 3);
+    gr_hessian_t* warm = gr_hessian_new(g_ctx, 3);
+    gr_hessian_set_warm_start(warm, 1);
+    
+    for (int step = 0; step < 50; step++) {
+        double point[] = {0.5 + 0.02 * step, -0.3 + 0.01 * step, 0.8 - 0.015 * step};
+        gr_hessian_compute_hyperdual(cold, varying_curvature_hd, NULL, point);
+        gr_hessian_compute_hyperdual(warm, varying_curvature_hd, NULL, point);
+        
+        double vc[3], vw[3], ec[9], ew[9];
+        TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_hessian_eigenvectors(cold, vc, ec, 3));
+        TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_hessian_eigenvectors(warm, vw, ew, 3));
+        
+        for (int j = 0; j < 3; j++) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-10, vc[j], vw[j]);
+        }
+        for (int j = 0; j < 9; j++) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-8, ec[j], ew[j]);
+        }
+    }
+    
+    gr_hessian_free(warm);
+    gr_hessian_free(cold);
+}
+
+void test_fragility_screening_matches_exhaustive(void)
+{
+    gr_state_space_t* space = make_quadratic_space();
+    gr_fragility_map_t* full = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_map_t* screened = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_map_set_screening(screened, 1);
+    
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(full));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(screened));
+    
+    /* Constant well-conditioned curvature: low-gradient nodes screen out */
+    TEST_ASSERT_GREATER_THAN(0, gr_fragility_map_get_num_screened(screened));
+    TEST_ASSERT_EQUAL_INT(0, gr_fragility_map_get_num_screened(full));
+    
+    size_t count = gr_fragility_map_get_num_fragile_regions(full);
+    TEST_ASSERT_GREATER_THAN(0, count);
+    TEST_ASSERT_EQUAL_INT(count, gr_fragility_map_get_num_fragile_regions(screened));
+    
+    for (size_t i = 0; i < count; i++) {
+        gr_fragility_point_t a, b;
+        gr_fragility_map_get_region(full, i, &a);
+        gr_fragility_map_get_region(screened, i, &b);
+        TEST_ASSERT_TRUE(a.fragility_score == b.fragility_score);
+        TEST_ASSERT_TRUE(a.coordinates[0] == b.coordinates[0]);
+        TEST_ASSERT_TRUE(a.coordinates[1] == b.coordinates[1]);
+    }
+    
+    /* Screened nodes skip their eigen-solve (anchors may still be solved) */
+    size_t total = gr_state_space_get_total_points(space);
+    size_t solves = gr_fragility_map_get_num_eigen_solves(screened);
+    TEST_ASSERT_EQUAL_INT(total, gr_fragility_map_get_num_eigen_solves(full));
+    TEST_ASSERT_TRUE(solves < total);
+    TEST_ASSERT_TRUE(solves >= total - gr_fragility_map_get_num_screened(screened));
+    
+    double max_full = gr_fragility_map_get_max(full);
+    double max_screened = gr_fragility_map_get_max(screened);
+    TEST_ASSERT_TRUE(memcmp(&max_full, &max_screened, sizeof(double)) == 0);
+    TEST_ASSERT_TRUE(gr_fragility_map_get_mean(screened) >= gr_fragility_map_get_mean(full));
+    
+    double point[] = {0.0, 0.5};
+    TEST_ASSERT_TRUE(gr_fragility_at_point(screened, point) >= gr_fragility_at_point(full, point));
+    
+    /* Nothing fragile: the maximum is settled from exact scores */
+    gr_fragility_config_t config;
+    gr_fragility_map_get_config(full, &config);
+    config.fragility_threshold = 0.99;
+    gr_fragility_map_set_config(full, &config);
+    gr_fragility_map_set_config(screened, &config);
+    gr_fragility_map_compute(full);
+    gr_fragility_map_compute(screened);
+    
+    TEST_ASSERT_EQUAL_INT(0, gr_fragility_map_get_num_fragile_regions(screened));
+    TEST_ASSERT_TRUE(gr_fragility_map_get_num_eigen_solves(screened) < total);
+    max_full = gr_fragility_map_get_max(full);
+    max_screened = gr_fragility_map_get_max(screened);
+    TEST_ASSERT_TRUE(memcmp(&max_full, &max_screened, sizeof(double)) == 0);
+    
+    gr_fragility_map_free(screened);
+    gr_fragility_map_free(full);
+    gr_state_space_free(space);
+}
+
+void test_hessian_vector_product_direct(void)
+{
+    double point[] = {0.4, -0.7, 1.1};
+    double v[] = {1.0, 2.0, -0.5};
+    double hv[3];
+    
+    /* Quadratic: H = [[2,1,0],[1,4,0],[0,0,6]], differences are exact */
+    gr_error_t err = gr_hessian_vector_product_direct(
+        g_ctx, coupled_quadratic, NULL, point, v, 3, hv);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, err);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 4.0, hv[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 9.0, hv[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, -3.0, hv[2]);
+    
+    /* Parallel evaluation gives the same result */
+    double hv_mt[3];
+    gr_context_set_num_threads(g_ctx, 4);
+    gr_context_set_pricer_reentrant(g_ctx, 1);
+    gr_hessian_vector_product_direct(g_ctx, coupled_quadratic, NULL, point, v, 3, hv_mt);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(hv[i] == hv_mt[i]);
+    }
+    
+    /* Adjoint pricer: two gradient calls */
+    gr_context_register_adjoint(g_ctx, counted_quadratic, quadratic_adjoint);
+    g_plain_calls = 0;
+    double w[] = {0.5, -1.0};
+    gr_hessian_vector_product_direct(g_ctx, counted_quadratic, NULL, point, w, 2, hv);
+    TEST_ASSERT_EQUAL_INT(0, g_plain_calls);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 1.0, hv[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, -2.0, hv[1]);
+    gr_context_register_adjoint(g_ctx, counted_quadratic, NULL);
+}
+
+void test_fragility_parallel_bitwise_identical(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -2.0,
+        .max_value = 2.0,
+        .num_points = 61
+    };
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, smooth_test_fn, NULL);
+    
+    gr_fragility_map_t* serial = gr_fragility_map_new(g_ctx, space);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(serial));
+    
+    gr_context_set_num_threads(g_ctx, 4);
+    gr_fragility_map_t* threaded = gr_fragility_map_new(g_ctx, space);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(threaded));
+    
+    size_t count = gr_fragility_map_get_num_fragile_regions(serial);
+    TEST_ASSERT_GREATER_THAN(0, count);
+    TEST_ASSERT_EQUAL_INT(count, gr_fragility_map_get_num_fragile_regions(threaded));
+    
+    for (size_t i = 0; i < count; i++) {
+        gr_fragility_point_t a, b;
+        gr_fragility_map_get_region(serial, i, &a);
+        gr_fragility_map_get_region(threaded, i, &b);
+        TEST_ASSERT_TRUE(memcmp(&a.fragility_score, &b.fragility_score, sizeof(double)) == 0);
+        TEST_ASSERT_TRUE(memcmp(a.coordinates, b.coordinates, 2 * sizeof(double)) == 0);
+    }
+    
+    double max_a = gr_fragility_map_get_max(serial);
+    double max_b = gr_fragility_map_get_max(threaded);
+    double mean_a = gr_fragility_map_get_mean(serial);
+    double mean_b = gr_fragility_map_get_mean(threaded);
+    TEST_ASSERT_TRUE(memcmp(&max_a, &max_b, sizeof(double)) == 0);
+    TEST_ASSERT_TRUE(memcmp(&mean_a, &mean_b, sizeof(double)) == 0);
+    
+    for (int i = 0; i < 61; i++) {
+        double pt[] = {-2.0 + 4.0 * i / 60.0, 2.0 - 4.0 * i / 60.0};
+        double sa = gr_fragility_at_point(serial, pt);
+        double sb = gr_fragility_at_point(threaded, pt);
+        TEST_ASSERT_TRUE(memcmp(&sa, &sb, sizeof(double)) == 0);
+    }
+    
+    gr_fragility_map_free(threaded);
+    gr_fragility_map_free(serial);
+    gr_state_space_free(space);
+}
+
+void test_fragility_fused_kernel_matches_objects(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -2.0,
+        .max_value = 2.0,
+        .num_points = 21
+    };
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, smooth_test_fn, NULL);
+    
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(map));
+    
+    gr_jacobian_t* jac = gr_jacobian_new(g_ctx, 2);
+    gr_hessian_t* hess = gr_hessian_new(g_ctx, 2);
+    
+    /* Default weights 0.25/0.30/0.25, unit scales, condition threshold 100 */
+    double nodes[][2] = { {0.4, -1.2}, {1.6, 0.8}, {-2.0, 2.0}, {0.0, 0.0} };
+    for (int i = 0; i < 4; i++) {
+        gr_local_geometry_compute(jac, hess, space, nodes[i]);
+        double g = gr_jacobian_norm(jac);
+        double f = gr_hessian_frobenius_norm(hess);
+        double c = gr_hessian_condition_number(hess);
+        double expected = 0.25 * g / (1.0 + g) + 0.30 * f / (1.0 + f)
+                        + 0.25 * (c < 1.0 ? 0.0 : log(c) / log(100.0));
+        if (expected > 1.0) expected = 1.0;
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, expected, gr_fragility_at_point(map, nodes[i]));
+    }
+    
+    gr_hessian_free(hess);
+    gr_jacobian_free(jac);
+    gr_fragility_map_free(map);
+    gr_state_space_free(space);
+}
+
+/* Quadratic with a sharp cubic ridge, used to re-mark part of the grid */
+static double remarked_quadratic(const double* coords, int num_dims, void* user_data)
+{
+    (void)user_data;
+    double x = coords[0], y = coords[1];
+    return simple_quadratic(coords, num_dims, NULL) + 3.0 * x * y * y;
+}
+
+void test_fragility_incremental_update(void)
+{
+    gr_state_space_t* space = make_quadratic_space();
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(map));
+    size_t before = gr_fragility_map_get_num_fragile_regions(map);
+    
+    /* Re-mark a block in the middle of the 21x21 grid */
+    int lo[] = {6, 8};
+    int hi[] = {11, 12};
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS,
+        gr_state_space_map_prices_box(space, remarked_quadratic, NULL, lo, hi));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_update(map, lo, hi));
+    
+    gr_fragility_map_t* ref = gr_fragility_map_new(g_ctx, space);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(ref));
+    
+    for (int i = 0; i < 21; i++) {
+        for (int j = 0; j < 21; j++) {
+            double pt[] = {-5.0 + 0.5 * i, -5.0 + 0.5 * j};
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, gr_fragility_at_point(ref, pt),
+                                      gr_fragility_at_point(map, pt));
+        }
+    }
+    
+    size_t count = gr_fragility_map_get_num_fragile_regions(ref);
+    TEST_ASSERT_TRUE(count != before);
+    TEST_ASSERT_EQUAL_INT(count, gr_fragility_map_get_num_fragile_regions(map));
+    for (size_t i = 0; i < count; i++) {
+        gr_fragility_point_t a, b;
+        gr_fragility_map_get_region(ref, i, &a);
+        gr_fragility_map_get_region(map, i, &b);
+        TEST_ASSERT_TRUE(a.coordinates[0] == b.coordinates[0]);
+        TEST_ASSERT_TRUE(a.coordinates[1] == b.coordinates[1]);
+    }
+    
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, gr_fragility_map_get_max(ref), gr_fragility_map_get_max(map));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, gr_fragility_map_get_mean(ref), gr_fragility_map_get_mean(map));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, gr_fragility_map_get_fragile_fraction(ref),
+                              gr_fragility_map_get_fragile_fraction(map));
+    
+    int bad_hi[] = {21, 12};
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_INVALID_ARGUMENT, gr_fragility_map_update(map, lo, bad_hi));
+    
+    gr_fragility_map_free(ref);
+    gr_fragility_map_free(map);
+    gr_state_space_free(space);
+}
+
+/* Flat plateau with one sharp bump near (1, -1) */
+static double localized_bump(const double* coords, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    double dx = coords[0] - 1.0, dy = coords[1] + 1.0;
+    return 4.0 * exp(-8.0 * (dx * dx + dy * dy));
+}
+
+void test_fragility_multires_search(void)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -4.0,
+        .max_value = 4.0,
+        .num_points = 129
+    };
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_add_dimension(space, &dim);
+    gr_state_space_map_prices(space, localized_bump, NULL);
+    
+    gr_fragility_map_t* full = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_map_t* fast = gr_fragility_map_new(g_ctx, space);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(full));
+    
+    size_t evaluated = 0;
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS,
+        gr_fragility_map_compute_multires(fast, 8, 0.3, &evaluated));
+    
+    size_t total = gr_state_space_get_total_points(space);
+    TEST_ASSERT_TRUE(evaluated < total / 4);
+    
+    /* Same fragile set: the bump is found and refined at full resolution */
+    size_t count = gr_fragility_map_get_num_fragile_regions(full);
+    TEST_ASSERT_GREATER_THAN(0, count);
+    TEST_ASSERT_EQUAL_INT(count, gr_fragility_map_get_num_fragile_regions(fast));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, gr_fragility_map_get_max(full), gr_fragility_map_get_max(fast));
+    
+    /* Entries come out in flat order with the components of their scoring */
+    for (size_t i = 0; i < count; i++) {
+        gr_fragility_point_t a, b;
+        gr_fragility_map_get_region(full, i, &a);
+        gr_fragility_map_get_region(fast, i, &b);
+        TEST_ASSERT_TRUE(a.coordinates[0] == b.coordinates[0]);
+        TEST_ASSERT_TRUE(a.coordinates[1] == b.coordinates[1]);
+        TEST_ASSERT_TRUE(a.curvature == b.curvature);
+        TEST_ASSERT_TRUE(a.gradient_norm == b.gradient_norm);
+    }
+    
+    double peak[] = {1.0, -1.0};
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, gr_fragility_at_point(full, peak),
+                              gr_fragility_at_point(fast, peak));
+    
+    /* Stride 1 scores everything */
+    gr_fragility_map_compute_multires(fast, 1, 0.0, &evaluated);
+    TEST_ASSERT_EQUAL_INT(total, evaluated);
+    
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_INVALID_ARGUMENT,
+        gr_fragility_map_compute_multires(fast, 0, 0.1, NULL));
+    
+    gr_fragility_map_free(fast);
+    gr_fragility_map_free(full);
+    gr_state_space_free(space);
+}
+
+static double twin_bumps(const double* coords, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    double ax = coords[0] + 2.0, ay = coords[1] + 2.0;
+    double bx = coords[0] - 2.0, by = coords[1] - 2.0;
+    return 4.0 * exp(-8.0 * (ax * ax + ay * ay)) +
+           3.0 * exp(-8.0 * (bx * bx + by * by));
+}
+
+/* Twin-bump prices on a grid over [-4, 4] with the given nodes per axis */
+static gr_state_space_t* make_twin_bumps_space(const int* num_points, int num_dims)
+{
+    gr_state_space_t* space = gr_state_space_new(g_ctx);
+    gr_dimension_t dim = {
+        .type = GR_DIM_CUSTOM,
+        .min_value = -4.0,
+        .max_value = 4.0
+    };
+    
+    for (int d = 0; d < num_dims; d++) {
+        dim.num_points = num_points[d];
+        gr_state_space_add_dimension(space, &dim);
+    }
+    
+    gr_state_space_map_prices(space, twin_bumps, NULL);
+    return space;
+}
+
+void test_fragility_clusters(void)
+{
+    int points[] = {81, 81};
+    gr_state_space_t* space = make_twin_bumps_space(points, 2);
+    
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_NOT_INITIALIZED, gr_fragility_map_cluster(map));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(map));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_cluster(map));
+    
+    /* One component per bump, together covering every fragile node */
+    size_t count = gr_fragility_map_get_num_clusters(map);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    
+    size_t volume = 0;
+    double best = 0.0;
+    for (size_t c = 0; c < count; c++) {
+        gr_fragility_cluster_t cl;
+        TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_get_cluster(map, c, &cl));
+        volume += cl.volume;
+        if (cl.peak_score > best) best = cl.peak_score;
+        
+        TEST_ASSERT_TRUE(cl.mean_score >= 0.5);
+        TEST_ASSERT_TRUE(cl.mean_score <= cl.peak_score);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, cl.peak_score, gr_fragility_at_point(map, cl.peak));
+        for (int d = 0; d < 2; d++) {
+            TEST_ASSERT_TRUE(cl.lower[d] <= cl.peak[d] && cl.peak[d] <= cl.upper[d]);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(gr_fragility_map_get_num_fragile_regions(map), volume);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, gr_fragility_map_get_max(map), best);
+    
+    /* Ordered by lowest flat index: the bump at (-2, -2) comes first */
+    gr_fragility_cluster_t first;
+    gr_fragility_map_get_cluster(map, 0, &first);
+    TEST_ASSERT_TRUE(first.upper[0] < 0.0 && first.upper[1] < 0.0);
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_INVALID_ARGUMENT,
+        gr_fragility_map_get_cluster(map, count, &first));
+    
+    gr_fragility_map_free(map);
+    gr_state_space_free(space);
+}
+
+void test_fragility_top_k(void)
+{
+    int points[] = {81, 81};
+    gr_state_space_t* space = make_twin_bumps_space(points, 2);
+    
+    gr_fragility_map_t* full = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_map_t* top = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_map_set_top_k(top, 10);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(full));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(top));
+    
+    size_t count = gr_fragility_map_get_num_fragile_regions(full);
+    TEST_ASSERT_TRUE(count > 10);
+    TEST_ASSERT_EQUAL_INT(10, gr_fragility_map_get_num_fragile_regions(top));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, gr_fragility_map_get_fragile_fraction(full),
+                              gr_fragility_map_get_fragile_fraction(top));
+    
+    /* Kept nodes are in flat order and none scores below a dropped node */
+    double weakest_kept = 2.0;
+    double prev_x = -1e300, prev_y = -1e300;
+    for (size_t i = 0; i < 10; i++) {
+        gr_fragility_point_t pt;
+        gr_fragility_map_get_region(top, i, &pt);
+        if (pt.fragility_score < weakest_kept) weakest_kept = pt.fragility_score;
+        TEST_ASSERT_DOUBLE_WITHIN(1e-15, pt.fragility_score,
+                                  gr_fragility_at_point(full, pt.coordinates));
+        TEST_ASSERT_TRUE(pt.coordinates[0] > prev_x ||
+                         (pt.coordinates[0] == prev_x && pt.coordinates[1] > prev_y));
+        prev_x = pt.coordinates[0];
+        prev_y = pt.coordinates[1];
+    }
+    
+    size_t above = 0;
+    for (size_t i = 0; i < count; i++) {
+        gr_fragility_point_t pt;
+        gr_fragility_map_get_region(full, i, &pt);
+        if (pt.fragility_score > weakest_kept) above++;
+    }
+    TEST_ASSERT_TRUE(above < 10);
+    
+    /* A bound above the fragile count keeps the full list */
+    gr_fragility_map_set_top_k(top, count + 5);
+    gr_fragility_map_compute(top);
+    TEST_ASSERT_EQUAL_INT(count, gr_fragility_map_get_num_fragile_regions(top));
+    for (size_t i = 0; i < count; i++) {
+        gr_fragility_point_t a, b;
+        gr_fragility_map_get_region(full, i, &a);
+        gr_fragility_map_get_region(top, i, &b);
+        TEST_ASSERT_TRUE(memcmp(&a.fragility_score, &b.fragility_score, sizeof(double)) == 0);
+        TEST_ASSERT_TRUE(memcmp(a.coordinates, b.coordinates, 2 * sizeof(double)) == 0);
+    }
+    
+    gr_fragility_map_free(top);
+    gr_fragility_map_free(full);
+    gr_state_space_free(space);
+}
+
+void test_fragility_constraint_field(void)
+{
+    gr_state_space_t* space = make_quadratic_space();
+    gr_constraint_surface_t* surface = gr_constraint_surface_new(g_ctx);
+    gr_constraint_add(surface, GR_CONSTRAINT_LIQUIDITY, "spread", 0.05);
+    
+    gr_fragility_map_t* plain = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_map_t* bound = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_map_set_constraints(bound, surface);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(plain));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(bound));
+    
+    /* Distance 0.05 against a 0.1 threshold: component 0.5 at weight 0.2 */
+    double coords[2];
+    for (int i = 0; i <= 20; i++) {
+        for (int j = 0; j <= 20; j++) {
+            coords[0] = -5.0 + 0.5 * i;
+            coords[1] = -5.0 + 0.5 * j;
+            TEST_ASSERT_DOUBLE_WITHIN(1e-15, 0.05, gr_constraint_distance(surface, coords, 2));
+            double base = gr_fragility_at_point(plain, coords);
+            double expected = base + 0.1 > 1.0 ? 1.0 : base + 0.1;
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, expected, gr_fragility_at_point(bound, coords));
+        }
+    }
+    
+    size_t count = gr_fragility_map_get_num_fragile_regions(bound);
+    TEST_ASSERT_TRUE(count > gr_fragility_map_get_num_fragile_regions(plain));
+    for (size_t i = 0; i < count; i++) {
+        gr_fragility_point_t pt;
+        gr_fragility_map_get_region(bound, i, &pt);
+        TEST_ASSERT_EQUAL_INT(1, pt.near_constraint);
+    }
+    
+    /* Unbinding restores the unconstrained scores */
+    gr_fragility_map_set_constraints(bound, NULL);
+    gr_fragility_map_compute(bound);
+    TEST_ASSERT_EQUAL_INT(gr_fragility_map_get_num_fragile_regions(plain),
+                          gr_fragility_map_get_num_fragile_regions(bound));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, gr_fragility_map_get_mean(plain),
+                              gr_fragility_map_get_mean(bound));
+    
+    gr_fragility_map_free(bound);
+    gr_fragility_map_free(plain);
+    gr_constraint_surface_free(surface);
+    gr_state_space_free(space);
+}
+
+static double coordinate_product(const double* coords, int num_dims, void* user_data)
+{
+    (void)num_dims;
+    (void)user_data;
+    return coords[0] * coords[1];
+}
+
+void test_fragility_constraint_field_varying(void)
+{
+    gr_state_space_t* space = make_quadratic_space();
+    gr_constraint_surface_t* surface = gr_constraint_surface_new(g_ctx);
+    
+    /* 3 - x, y + 4, 10 - xy and a constant 6: the minimum varies by node */
+    gr_constraint_add(surface, GR_CONSTRAINT_POSITION_LIMIT, "x", 3.0);
+    gr_constraint_add(surface, GR_CONSTRAINT_MARGIN, "y", -4.0);
+    gr_constraint_add(surface, GR_CONSTRAINT_CUSTOM, "xy", 10.0);
+    gr_constraint_add(surface, GR_CONSTRAINT_LIQUIDITY, "spread", 6.0);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_constraint_bind_dimension(surface, 0, 0));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_constraint_bind_dimension(surface, 1, 1));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS,
+                          gr_constraint_bind_function(surface, 2, coordinate_product, NULL));
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_INVALID_ARGUMENT, gr_constraint_bind_dimension(surface, 4, 0));
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_NULL_POINTER, gr_constraint_bind_function(surface, 2, NULL, NULL));
+    
+    double probe[] = {5.0, 5.0};
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, -15.0, gr_constraint_distance(surface, probe, 2));
+    
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_map_set_constraints(map, surface);
+    gr_fragility_map_set_component_cache(map, 1);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(map));
+    
+    const char* path = "test_fragility_constraints.grf";
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_export(map, path));
+    FILE* f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    size_t size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    double* base = (double*)malloc(size);
+    TEST_ASSERT_EQUAL_INT(size, fread(base, 1, size, f));
+    fclose(f);
+    remove(path);
+    
+    uint64_t count = 0;
+    const double* field = (const double*)gr_columnar_column_data(
+        base, size, GR_COLUMN_CONSTRAINT_DISTANCE, &count);
+    TEST_ASSERT_NOT_NULL(field);
+    TEST_ASSERT_EQUAL_INT(21 * 21, count);
+    
+    double coords[2];
+    for (int i = 0; i <= 20; i++) {
+        for (int j = 0; j <= 20; j++) {
+            coords[0] = -5.0 + 0.5 * i;
+            coords[1] = -5.0 + 0.5 * j;
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, gr_constraint_distance(surface, coords, 2),
+                                      field[i * 21 + j]);
+        }
+    }
+    
+    free(base);
+    gr_fragility_map_free(map);
+    gr_constraint_surface_free(surface);
+    gr_state_space_free(space);
+}
+
+void test_fragility_rescore_from_cache(void)
+{
+    int points[] = {41, 41};
+    gr_state_space_t* space = make_twin_bumps_space(points, 2);
+    
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    gr_fragility_config_t cfg;
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_get_config(map, &cfg));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 0.5, cfg.fragility_threshold);
+    
+    /* Nothing cached yet */
+    gr_fragility_map_compute(map);
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_NOT_INITIALIZED, gr_fragility_map_rescore(map, &cfg));
+    
+    gr_fragility_map_set_component_cache(map, 1);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(map));
+    size_t before = gr_fragility_map_get_num_fragile_regions(map);
+    
+    cfg.gradient_weight = 0.1;
+    cfg.condition_weight = 0.5;
+    cfg.curvature_scale = 4.0;
+    cfg.fragility_threshold = 0.3;
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_rescore(map, &cfg));
+    
+    /* Reference: a full compute under the new configuration */
+    gr_fragility_map_t* ref = gr_fragility_map_new(g_ctx, space);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_set_config(ref, &cfg));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_compute(ref));
+    
+    size_t count = gr_fragility_map_get_num_fragile_regions(ref);
+    TEST_ASSERT_TRUE(count != before);
+    TEST_ASSERT_EQUAL_INT(count, gr_fragility_map_get_num_fragile_regions(map));
+    
+    double mean_a = gr_fragility_map_get_mean(map), mean_b = gr_fragility_map_get_mean(ref);
+    double max_a = gr_fragility_map_get_max(map), max_b = gr_fragility_map_get_max(ref);
+    TEST_ASSERT_TRUE(memcmp(&mean_a, &mean_b, sizeof(double)) == 0);
+    TEST_ASSERT_TRUE(memcmp(&max_a, &max_b, sizeof(double)) == 0);
+    
+    for (size_t i = 0; i < count; i++) {
+        gr_fragility_point_t a, b;
+        gr_fragility_map_get_region(map, i, &a);
+        gr_fragility_map_get_region(ref, i, &b);
+        TEST_ASSERT_TRUE(memcmp(&a.fragility_score, &b.fragility_score, sizeof(double)) == 0);
+        TEST_ASSERT_TRUE(memcmp(a.coordinates, b.coordinates, 2 * sizeof(double)) == 0);
+        TEST_ASSERT_TRUE(memcmp(&a.gradient_norm, &b.gradient_norm, sizeof(double)) == 0);
+    }
+    
+    gr_fragility_map_free(ref);
+    gr_fragility_map_free(map);
+    gr_state_space_free(space);
+}
+
+void test_fragility_interpolated_queries(void)
+{
+    int points[] = {41, 41};
+    gr_state_space_t* space = make_twin_bumps_space(points, 2);
+    
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    double out[64];
+    double pts[64 * 2];
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_NOT_INITIALIZED,
+        gr_fragility_at_points_interpolated(map, pts, 1, out));
+    gr_fragility_map_compute(map);
+    
+    /* Nodes reproduce the grid; cell midpoints average their corners */
+    double node[] = {-2.0, -1.6};
+    double snapped = gr_fragility_at_point(map, node);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, snapped, gr_fragility_at_point_interpolated(map, node));
+    
+    double right[] = {-1.8, -1.6};
+    double up[] = {-2.0, -1.4};
+    double diag[] = {-1.8, -1.4};
+    double mid[] = {-1.9, -1.5};
+    double corners = snapped + gr_fragility_at_point(map, right) +
+                     gr_fragility_at_point(map, up) + gr_fragility_at_point(map, diag);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.25 * corners, gr_fragility_at_point_interpolated(map, mid));
+    
+    /* Outside the grid clamps to the edge */
+    double far[] = {10.0, -10.0};
+    double edge[] = {4.0, -4.0};
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, gr_fragility_at_point(map, edge),
+                              gr_fragility_at_point_interpolated(map, far));
+    double very_far[] = {1e12, -1e12};
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, gr_fragility_at_point(map, edge),
+                              gr_fragility_at_point_interpolated(map, very_far));
+    very_far[0] = NAN;
+    TEST_ASSERT_TRUE(isnan(gr_fragility_at_point_interpolated(map, very_far)));
+    
+    /* Batch matches single queries */
+    for (int i = 0; i < 64; i++) {
+        pts[2 * i] = -5.0 + 10.0 * (double)((i * 37) % 64) / 63.0;
+        pts[2 * i + 1] = -5.0 + 10.0 * (double)((i * 11) % 64) / 63.0;
+    }
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_at_points_interpolated(map, pts, 64, out));
+    for (int i = 0; i < 64; i++) {
+        double single = gr_fragility_at_point_interpolated(map, &pts[2 * i]);
+        TEST_ASSERT_TRUE(memcmp(&single, &out[i], sizeof(double)) == 0);
+    }
+    
+    gr_fragility_map_free(map);
+    gr_state_space_free(space);
+}
+
+void test_fragility_columnar_export(void)
+{
+    int points[] = {41, 33};
+    gr_state_space_t* space = make_twin_bumps_space(points, 2);
+    
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    const char* path = "test_fragility_export.grf";
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_NOT_INITIALIZED, gr_fragility_map_export(map, path));
+    
+    gr_fragility_map_set_component_cache(map, 1);
+    gr_fragility_map_compute(map);
+    gr_fragility_map_cluster(map);
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_export(map, path));
+    
+    FILE* f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    size_t size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    double* base = (double*)malloc(size);
+    TEST_ASSERT_EQUAL_INT(size, fread(base, 1, size, f));
+    fclose(f);
+    remove(path);
+    
+    const gr_columnar_header_t* h = gr_columnar_header(base, size);
+    TEST_ASSERT_NOT_NULL(h);
+    TEST_ASSERT_EQUAL_INT(2, h->num_dims);
+    TEST_ASSERT_EQUAL_INT(41 * 33, h->total_points);
+    TEST_ASSERT_EQUAL_INT(gr_fragility_map_get_num_clusters(map), h->num_clusters);
+    TEST_ASSERT_EQUAL_INT(gr_fragility_map_get_num_fragile_regions(map), h->num_fragile);
+    
+    const gr_columnar_dimension_t* dims =
+        (const gr_columnar_dimension_t*)((const char*)base + h->dims_offset);
+    TEST_ASSERT_EQUAL_INT(33, dims[1].num_points);
+    TEST_ASSERT_EQUAL_INT(33, dims[0].stride);
+    
+    /* Columns are aligned and hold the map's data unchanged */
+    uint64_t count = 0;
+    const double* scores = (const double*)gr_columnar_column_data(base, size, GR_COLUMN_SCORES, &count);
+    TEST_ASSERT_NOT_NULL(scores);
+    TEST_ASSERT_EQUAL_INT(0, ((const char*)scores - (const char*)base) % GR_COLUMNAR_ALIGN);
+    TEST_ASSERT_EQUAL_INT(h->total_points, count);
+    
+    double coords[2];
+    for (int i = 0; i < 41; i++) {
+        for (int j = 0; j < 33; j++) {
+            coords[0] = -4.0 + 0.2 * i;
+            coords[1] = -4.0 + 0.25 * j;
+            double expected = gr_fragility_at_point(map, coords);
+            TEST_ASSERT_TRUE(memcmp(&expected, &scores[i * 33 + j], sizeof(double)) == 0);
+        }
+    }
+    
+    TEST_ASSERT_NOT_NULL(gr_columnar_column_data(base, size, GR_COLUMN_CONDITION, &count));
+    TEST_ASSERT_EQUAL_INT(h->total_points, count);
+    TEST_ASSERT_NULL(gr_columnar_column_data(base, size, GR_COLUMN_CONSTRAINT_DISTANCE, NULL));
+    
+    const uint64_t* nodes = (const uint64_t*)gr_columnar_column_data(
+        base, size, GR_COLUMN_FRAGILE_NODES, &count);
+    TEST_ASSERT_EQUAL_INT(h->num_fragile, count);
+    gr_fragility_point_t pt;
+    gr_fragility_map_get_region(map, 0, &pt);
+    TEST_ASSERT_TRUE(scores[nodes[0]] == pt.fragility_score);
+    
+    const uint64_t* volume = (const uint64_t*)gr_columnar_column_data(
+        base, size, GR_COLUMN_CLUSTER_VOLUME, &count);
+    const double* peak = (const double*)gr_columnar_column_data(
+        base, size, GR_COLUMN_CLUSTER_PEAK, NULL);
+    TEST_ASSERT_EQUAL_INT(h->num_clusters, count);
+    for (uint64_t c = 0; c < count; c++) {
+        gr_fragility_cluster_t cl;
+        gr_fragility_map_get_cluster(map, c, &cl);
+        TEST_ASSERT_EQUAL_INT(cl.volume, volume[c]);
+        TEST_ASSERT_TRUE(memcmp(cl.peak, &peak[2 * c], 2 * sizeof(double)) == 0);
+    }
+    
+    /* Corrupt tables and column entries are rejected, including wrapped sizes */
+    gr_columnar_header_t* hw = (gr_columnar_header_t*)base;
+    gr_columnar_column_t* cols = (gr_columnar_column_t*)((char*)base + hw->columns_offset);
+    uint64_t saved = hw->columns_offset;
+    hw->columns_offset = UINT64_MAX - 7u;
+    TEST_ASSERT_NULL(gr_columnar_header(base, size));
+    hw->columns_offset = saved;
+    
+    gr_columnar_column_t entry = cols[0];
+    TEST_ASSERT_EQUAL_INT(GR_COLUMN_SCORES, entry.id);
+    cols[0].count = UINT64_MAX / 8u + 1u;
+    TEST_ASSERT_NULL(gr_columnar_column_data(base, size, GR_COLUMN_SCORES, NULL));
+    cols[0] = entry;
+    cols[0].offset += 8u;
+    TEST_ASSERT_NULL(gr_columnar_column_data(base, size, GR_COLUMN_SCORES, NULL));
+    cols[0] = entry;
+    cols[0].type = 3u;
+    TEST_ASSERT_NULL(gr_columnar_column_data(base, size, GR_COLUMN_SCORES, NULL));
+    cols[0] = entry;
+    TEST_ASSERT_NOT_NULL(gr_columnar_column_data(base, size, GR_COLUMN_SCORES, NULL));
+    
+    /* Corrupt magic is rejected */
+    ((char*)base)[0] = 'X';
+    TEST_ASSERT_NULL(gr_columnar_header(base, size));
+    free(base);
+    
+    /* A recompute drops the cluster table rather than exporting a stale one */
+    gr_fragility_map_compute(map);
+    TEST_ASSERT_EQUAL_INT(0, gr_fragility_map_get_num_clusters(map));
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_map_export(map, path));
+    f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    base = (double*)malloc(size);
+    TEST_ASSERT_EQUAL_INT(size, fread(base, 1, size, f));
+    fclose(f);
+    remove(path);
+    TEST_ASSERT_NULL(gr_columnar_column_data(base, size, GR_COLUMN_CLUSTER_VOLUME, NULL));
+    
+    free(base);
+    gr_fragility_map_free(map);
+    gr_state_space_free(space);
+}
+
+void test_fragility_level_sets(void)
+{
+    int points[] = {41, 41, 5};
+    gr_state_space_t* space = make_twin_bumps_space(points, 3);
+    
+    gr_fragility_map_t* map = gr_fragility_map_new(g_ctx, space);
+    gr_level_set_t contour;
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_NOT_INITIALIZED,
+                          gr_fragility_contour_2d(map, 0, 1, NULL, 0.5, &contour));
+    gr_fragility_map_compute(map);
+    
+    gr_fragility_config_t config;
+    gr_fragility_map_get_config(map, &config);
+    double level = config.fragility_threshold;
+    int fixed[3] = {0, 0, 2};
+    
+    /* Vertices lie on grid edges, where interpolation is linear */
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_contour_2d(map, 0, 1, fixed, level, &contour));
+    TEST_ASSERT_EQUAL_INT(2, contour.dims);
+    TEST_ASSERT_TRUE(contour.num_elements > 0);
+    for (size_t v = 0; v < contour.num_vertices; v++) {
+        double p[3] = { contour.vertices[2 * v], contour.vertices[2 * v + 1], 0.0 };
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, level, gr_fragility_at_point_interpolated(map, p));
+    }
+    
+    /* One vertex per crossed edge, shared by the (at most two) cells on it */
+    TEST_ASSERT_TRUE(contour.num_vertices < 2 * contour.num_elements);
+    size_t* uses = (size_t*)calloc(contour.num_vertices, sizeof(size_t));
+    for (size_t i = 0; i < 2 * contour.num_elements; i++) {
+        TEST_ASSERT_TRUE(contour.indices[i] < contour.num_vertices);
+        uses[contour.indices[i]]++;
+    }
+    for (size_t v = 0; v < contour.num_vertices; v++) {
+        TEST_ASSERT_TRUE(uses[v] == 1 || uses[v] == 2);
+    }
+    free(uses);
+    
+    /* Same output for any thread count */
+    gr_level_set_t contour_mt;
+    gr_context_set_num_threads(g_ctx, 4);
+    gr_fragility_contour_2d(map, 0, 1, fixed, level, &contour_mt);
+    TEST_ASSERT_EQUAL_INT(contour.num_elements, contour_mt.num_elements);
+    TEST_ASSERT_EQUAL_INT(contour.num_vertices, contour_mt.num_vertices);
+    TEST_ASSERT_TRUE(memcmp(contour.vertices, contour_mt.vertices,
+                            contour.num_vertices * 2 * sizeof(double)) == 0);
+    TEST_ASSERT_TRUE(memcmp(contour.indices, contour_mt.indices,
+                            contour.num_elements * 2 * sizeof(size_t)) == 0);
+    
+    gr_level_set_t surface;
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_isosurface_3d(map, 0, 1, 2, NULL, level, &surface));
+    TEST_ASSERT_EQUAL_INT(3, surface.dims);
+    TEST_ASSERT_TRUE(surface.num_elements > 0);
+    TEST_ASSERT_TRUE(surface.num_vertices < surface.num_elements);
+    for (size_t i = 0; i < 3 * surface.num_vertices; i++) {
+        TEST_ASSERT_TRUE(surface.vertices[i] >= -4.0 && surface.vertices[i] <= 4.0);
+    }
+    for (size_t i = 0; i < 3 * surface.num_elements; i++) {
+        TEST_ASSERT_TRUE(surface.indices[i] < surface.num_vertices);
+    }
+    
+    /* Every listed cell straddles the level; the contour crosses only those */
+    gr_boundary_cells_t cells;
+    TEST_ASSERT_EQUAL_INT(GR_SUCCESS, gr_fragility_boundary_cells(map, level, &cells));
+    TEST_ASSERT_TRUE(cells.num_cells > 0);
+    for (size_t c = 0; c < cells.num_cells; c++) {
+        size_t flat = cells.cells[c];
+        int above = 0;
+        for (int k = 0; k < 8; k++) {
+            double p[3] = {
+                -4.0 + 0.2 * (double)(flat / (41 * 5) + (k & 1)),
+                -4.0 + 0.2 * (double)((flat / 5) % 41 + ((k >> 1) & 1)),
+                -4.0 + 2.0 * (double)(flat % 5 + ((k >> 2) & 1))
+            };
+            if (gr_fragility_at_point(map, p) >= level) above++;
+        }
+        TEST_ASSERT_TRUE(above > 0 && above < 8);
+        if (c > 0) TEST_ASSERT_TRUE(cells.cells[c - 1] < flat);
+    }
+    
+    gr_level_set_t rejected;
+    int bad[3] = {0, 0, 5};
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_INVALID_ARGUMENT,
+                          gr_fragility_contour_2d(map, 0, 1, bad, level, &rejected));
+    TEST_ASSERT_EQUAL_INT(GR_ERROR_INVALID_ARGUMENT,
+                          gr_fragility_contour_2d(map, 1, 1, NULL, level, &rejected));
+    TEST_ASSERT_NULL(rejected.vertices);
+    TEST_ASSERT_NULL(rejected.indices);
+    
+    gr_level_set_free(map, &contour);
+    gr_level_set_free(map, &contour_mt);
+    gr_level_set_free(map, &surface);
+    gr_boundary_cells_free(map, &cells);
+    gr_fragility_map_free(map);
+    gr_state_space_free(space);
+}
+
+static size_t g_alloc_count = 0;
+
+static void* counting_malloc(size_t size)
+{
+    g_alloc_count++;
+    return malloc(size);
+}
+
+static void* counting_realloc(void* ptr, size_t size)
+{
+    g_alloc_count++;
+    return realloc(ptr, size);
+}
+
+void test_analysis_hot_path_allocation_free(void)
+{
+    gr_set_allocators(counting_malloc, counting_realloc, free);
+    
+    gr_state_space_t* space = make_quadratic_space();
+    gr_jacobian_t* jac = gr_jacobian_new(g_ctx, 2);
+    gr_hessian_t* hess = gr_hessian_new(g_ctx, 2);
+    double point[] = {2.0, 3.0};
+    double eig[2];
+    
+    size_t before = g_alloc_count;
+    
+    for (int i = 0; i < 10; i++) {
+        gr_jacobian_compute(jac, space, point);
+        gr_jacobian_compute_direct(jac, simple_quadratic, NULL, point, 0.0);
+        gr_hessian_compute(hess, space, point);
+        gr_hessian_eigenvalues(hess, eig, 2);
+        gr_local_geometry_compute(jac, hess, space, point);
+        gr_hessian_condition_number(hess);
+    }
+    
+    TEST_ASSERT_EQUAL_INT(before, g_alloc_count);
+    
+    gr_hessian_free(hess);
+    gr_jacobian_free(jac);
+    gr_state_space_free(space);
+    
+    gr_set_allocators(NULL, NULL, NULL);
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -639,5 +2171,121 @@ int main(void)
     RUN_TEST(test_integration_hessian_on_quadratic);
     tearDown();
     
+    setUp();
+    RUN_TEST(test_integration_local_geometry_on_quadratic);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_integration_fragility_on_quadratic);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_hyperdual_exact_derivatives);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_jacobian_adaptive_richardson);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_jacobian_direct_parallel_matches_serial);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_analysis_hot_path_allocation_free);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_directional_derivative_on_quadratic);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_adjoint_pricer_gradients);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_local_geometry_analytic_interpolant);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_hessian_eigenvectors);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_hessian_lanczos_extremes);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_hessian_lanczos_repeated_eigenvalue);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_state_space_hessian_field);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_state_space_hessian_field_blocks);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_hessian_warm_start_scan);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_screening_matches_exhaustive);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_hessian_vector_product_direct);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_parallel_bitwise_identical);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_fused_kernel_matches_objects);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_incremental_update);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_multires_search);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_clusters);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_top_k);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_constraint_field);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_constraint_field_varying);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_rescore_from_cache);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_interpolated_queries);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_columnar_export);
+    tearDown();
+    
+    setUp();
+    RUN_TEST(test_fragility_level_sets);
+    tearDown();
+    
     return UnityEnd();
 }